@@ -0,0 +1,290 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i10_character_moves.cpp
+ * Description:
+ *   The i5 Character reworked for copy elision and move semantics, a growable
+ *   Party with in-place emplacement, and allocation-count checks per operation.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    Every std::string longer than ~15 characters keeps its text on the HEAP. Copying such a
+    string means a new heap allocation, moving it just steals the pointer. So the number of
+    allocations a Character costs depends on how carefully we move instead of copy.
+
+    Where i5 used to copy:
+        Character(std::string name) : name(name)   -> copies the parameter (1 extra allocation)
+        std::string getName() const                -> returns a copy (1 allocation per call)
+        (user-declared destructor)                 -> NO automatic move constructor, so every
+                                                      container relocation copies the name
+
+    The fixes:
+        : name(std::move(name))                    -> steal the parameter's buffer
+        const std::string& getName() const         -> hand out a reference, no copy
+        Character(Character&&) noexcept = default  -> containers may MOVE when they grow.
+                                                      std::vector (and Party below) only move
+                                                      if the move can't throw, otherwise they
+                                                      copy to stay safe.
+
+    Emplacement:
+        party.emplace("Name") builds the Character directly inside the party's memory with
+        "placement new", instead of building a temporary and moving it in.
+
+    The checks in main() count allocations per operation and the program exits with 1 if any
+    operation needs MORE allocations than listed, so run_all.sh reports the regression.
+*/
+
+#include <iostream>
+#include <cstdint>      // For fixed-width integer types
+#include <cstdlib>      // For std::malloc / std::free
+#include <new>          // For placement new and std::bad_alloc
+#include <string>
+#include <utility>      // For std::move, std::forward, std::move_if_noexcept
+#include <vector>
+#include <type_traits>  // For std::is_nothrow_move_constructible
+
+// ============================================================
+// Allocation counter
+// ============================================================
+#ifdef ALLOC_PROFILE
+// Built with -DALLOC_PROFILE=ON: the profiler already replaces operator new, ask it instead
+extern "C" uint64_t alloc_profile_allocation_count();
+uint64_t allocationCount() { return alloc_profile_allocation_count(); }
+#else
+uint64_t allocations = 0;
+uint64_t allocationCount() { return allocations; }
+
+void* countedAlloc(size_t size) {
+    allocations++;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// Replacing the global operator new lets us see every heap allocation in the program
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+#endif
+
+// ============================================================
+// Character (same rework as i5, without the console messages)
+// ============================================================
+class Character {
+private:
+    std::string name;
+    int level;
+public:
+    Character(std::string name) : name(std::move(name)), level(1) {}
+    ~Character() {}
+
+    Character(const Character&) = default;
+    Character& operator=(const Character&) = default;
+    Character(Character&&) noexcept = default;
+    Character& operator=(Character&&) noexcept = default;
+
+    void increaseLevel(int levelCoin) {
+        level += levelCoin;
+    }
+
+    int getLevel() const {
+        return level;
+    }
+
+    const std::string& getName() const {
+        return name;
+    }
+};
+
+static_assert(std::is_nothrow_move_constructible<Character>::value, "containers must be able to move Characters");
+static_assert(std::is_nothrow_move_assignable<Character>::value, "containers must be able to move Characters");
+
+// ============================================================
+// Party - a growable array of Characters built on raw pointers
+// ============================================================
+class Party {
+private:
+    Character* members = nullptr; // raw storage, only [0, count) holds live Characters
+    size_t count = 0;
+    size_t capacity = 0;
+
+    // Moves every member into a bigger block: ONE allocation, no name copies
+    void relocate(size_t newCapacity, Character* bigger) {
+        for (size_t i = 0; i < count; i++) {
+            new (bigger + i) Character(std::move_if_noexcept(members[i])); // placement new
+            members[i].~Character();
+        }
+        ::operator delete(members);
+        members = bigger;
+        capacity = newCapacity;
+    }
+
+public:
+    Party() = default;
+    explicit Party(size_t initialCapacity) { reserve(initialCapacity); }
+    ~Party() {
+        for (size_t i = 0; i < count; i++) members[i].~Character();
+        ::operator delete(members);
+    }
+
+    // A Party owns its members, so it can be moved but not copied
+    Party(const Party&) = delete;
+    Party& operator=(const Party&) = delete;
+    Party(Party&& other) noexcept : members(other.members), count(other.count), capacity(other.capacity) {
+        other.members = nullptr;
+        other.count = other.capacity = 0;
+    }
+
+    void reserve(size_t newCapacity) {
+        if (newCapacity <= capacity) return;
+        relocate(newCapacity, static_cast<Character*>(::operator new(newCapacity * sizeof(Character))));
+    }
+
+    // Builds a Character in place from the given constructor arguments
+    template <typename... Args>
+    Character& emplace(Args&&... args) {
+        if (count < capacity) {
+            Character* slot = new (members + count) Character(std::forward<Args>(args)...);
+            count++;
+            return *slot;
+        }
+        // Full: build the new member in the bigger block FIRST, because "args" may refer to a
+        // member of this party that relocate() is about to move away
+        size_t newCapacity = capacity ? capacity * 2 : 4;
+        Character* bigger = static_cast<Character*>(::operator new(newCapacity * sizeof(Character)));
+        Character* slot;
+        try {
+            slot = new (bigger + count) Character(std::forward<Args>(args)...);
+        } catch (...) {
+            ::operator delete(bigger); // the party is untouched, only the new block has to go
+            throw;
+        }
+        relocate(newCapacity, bigger);
+        count++;
+        return *slot;
+    }
+
+    size_t size() const { return count; }
+    size_t getCapacity() const { return capacity; }
+    Character& operator[](size_t i) { return members[i]; }
+    Character* begin() { return members; }
+    Character* end() { return members + count; }
+};
+
+// ============================================================
+// Allocation checks
+// ============================================================
+int failures = 0;
+
+// Blocks std::vector allocates while growing to 6 elements without reserve()
+#ifdef _MSC_VER
+constexpr uint64_t VECTOR_GROWTH_BLOCKS = 5; // capacity 1, 2, 3, 4, 6 (grows by 1.5x)
+#else
+constexpr uint64_t VECTOR_GROWTH_BLOCKS = 4; // capacity 1, 2, 4, 8 (grows by 2x)
+#endif
+
+// Runs "operation" and fails if it allocated more than "expected" times
+template <typename Operation>
+void expectAllocations(const char* what, uint64_t expected, Operation operation) {
+    uint64_t before = allocationCount();
+    operation();
+    uint64_t actual = allocationCount() - before;
+
+    if (actual > expected) {
+        std::cout << "[FAIL] " << what << ": " << actual << " allocation(s), expected " << expected << "\n";
+        failures++;
+    } else {
+        // Fewer is fine - an optimizing compiler may remove a new/delete pair entirely
+        std::cout << "[PASS] " << what << ": " << actual << " allocation(s)\n";
+    }
+}
+
+// All names are longer than the small-string buffer, so every copy would cost an allocation
+const char* heroNames[] = {
+    "Warrior of the Northern Wastes", "Mage of the Crimson Tower", "Archer of the Silent Wood",
+    "Healer of the Sunken Temple", "Rogue of the Glass Market", "Paladin of the Seventh Dawn",
+};
+
+int main() {
+    std::cout << "[System] Counting heap allocations per operation...\n";
+
+    // 1) Construction
+    expectAllocations("construct from string literal", 1, [] {
+        Character hero(heroNames[0]); // 1 = the name's buffer, moved (not copied) into the member
+    });
+
+    std::string longName = heroNames[1];
+    expectAllocations("construct from std::string lvalue (copy is intended)", 1, [&] {
+        Character hero(longName);
+    });
+    expectAllocations("construct from std::move(std::string)", 0, [&] {
+        Character hero(std::move(longName)); // steals longName's buffer
+    });
+
+    // 2) Access
+    Character hero(heroNames[2]);
+    expectAllocations("getName()", 0, [&] {
+        const std::string& name = hero.getName();
+        if (name.empty()) std::cout << "unreachable\n";
+    });
+
+    // 3) Relocation
+    expectAllocations("move construct", 0, [&] {
+        Character moved(std::move(hero));
+        hero = std::move(moved);       // and move assign it back
+    });
+
+    // 4) Heap array, like i5 (1 array + 1 per name, no temporary Characters)
+    expectAllocations("new Character[2] { {...}, {...} }", 3, [] {
+        Character* party = new Character[2] { {heroNames[1]}, {heroNames[2]} };
+        delete[] party;
+    });
+
+    // 5) Party with in-place emplacement
+    expectAllocations("Party(6) + 6 x emplace", 1 + 6, [] {
+        Party party(6);
+        for (const char* name : heroNames) party.emplace(name);
+    });
+
+    Party party;
+    for (int i = 0; i < 4; i++) party.emplace(heroNames[i]); // fills the first block (capacity 4)
+    expectAllocations("Party growth 4 -> 8 (1 block + 1 name, members moved)", 2, [&] {
+        party.emplace(heroNames[4]);
+    });
+    for (int i = 0; i < 3; i++) party.emplace(heroNames[5]); // 8 members, full again
+    expectAllocations("Party growth 8 -> 16 copying its own member (1 block + 1 name)", 2, [&] {
+        party.emplace(party[0]); // party[0] is copied BEFORE relocation moves it away
+    });
+    if (party[8].getName() != heroNames[0]) {
+        std::cout << "[FAIL] self-emplace copied the wrong name\n";
+        failures++;
+    }
+    expectAllocations("move a whole Party", 0, [&] {
+        Party moved(std::move(party));
+    });
+
+    // 6) std::vector, for comparison
+    expectAllocations("vector reserve(6) + 6 x emplace_back", 1 + 6, [] {
+        std::vector<Character> members;
+        members.reserve(6);
+        for (const char* name : heroNames) members.emplace_back(name);
+    });
+    expectAllocations("vector growth without reserve (no name copies)", 6 + VECTOR_GROWTH_BLOCKS, [] {
+        std::vector<Character> members; // every growth is one block, names are always moved
+        for (const char* name : heroNames) members.emplace_back(name);
+    });
+
+    std::cout << (failures ? "[System] Allocation regression detected!\n" : "[System] All allocation checks passed.\n");
+    return failures ? 1 : 0;
+}
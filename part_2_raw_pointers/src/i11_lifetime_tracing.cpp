@@ -0,0 +1,293 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i11_lifetime_tracing.cpp
+ * Description:
+ *   A low-overhead tracing layer that records object lifetimes, attack/levelUp
+ *   spans and register writes, and exports them as Chrome trace / Perfetto JSON.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    In i5 the only way to see when a Character lives and dies is the "[System] ... has entered
+    the game!" text. That is fine for 3 characters, useless for 3000.
+
+    Instead, this example records EVENTS:
+        - lifetime begin/end  -> constructor / destructor (one bar per object on the timeline)
+        - spans               -> attack() and levelUp(), with start time and duration
+        - counter             -> every write to i6's LED register, with the written value
+
+    Keeping it cheap:
+        Each thread writes into its OWN fixed-size buffer (thread_local pointer), so recording
+        an event is a few stores with no lock and no allocation. Locks are only taken once per
+        thread (to register its buffer) and at the end when everything is written out.
+
+    Output:
+        The events are flushed as Chrome trace JSON ("traceEvents"). Open the file in
+        https://ui.perfetto.dev or chrome://tracing to see the timeline.
+
+    Usage:
+        ./i11_lifetime_tracing [output.json]   (default: trace_i11.json)
+*/
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>    // For std::setprecision
+#include <cstdint>    // For fixed-width integer types
+#include <cstring>    // For std::strncpy
+#include <string>
+#include <utility>    // For std::move
+#include <vector>
+#include <memory>     // For std::unique_ptr (the tracer owns the buffers)
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+// ============================================================
+// Tracing layer
+// ============================================================
+struct TraceEvent {
+    char name[32];       // copied, the traced object may be gone when we flush
+    const char* category;
+    char phase;          // Chrome trace phase: 'X' span, 'b'/'e' async begin/end, 'C' counter
+    uint64_t tsNs;       // start time
+    uint64_t durNs;      // 'X' only
+    uint64_t id;         // 'b'/'e' only - pairs a lifetime's begin with its end
+    uint64_t value;      // 'C' only
+};
+
+class TraceBuffer {
+public:
+    static constexpr size_t CAPACITY = 1 << 14;
+    TraceEvent events[CAPACITY];
+    size_t count = 0;
+    uint64_t dropped = 0; // events lost because the buffer was full
+    int threadIndex = 0;
+    std::string threadName;
+};
+
+class Tracer {
+private:
+    static std::mutex mutex;                                  // guards "buffers" only
+    static std::vector<std::unique_ptr<TraceBuffer>> buffers;
+    static thread_local TraceBuffer* local;                   // this thread's buffer
+    static const std::chrono::steady_clock::time_point start;
+
+    // First event on a thread: create and register its buffer (the only locked step)
+    static TraceBuffer* registerThread() {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.push_back(std::unique_ptr<TraceBuffer>(new TraceBuffer()));
+        local = buffers.back().get();
+        local->threadIndex = (int)buffers.size();
+        local->threadName = "thread " + std::to_string(local->threadIndex);
+        return local;
+    }
+
+    static void writeEscaped(std::ostream& out, const char* text) {
+        for (const char* c = text; *c; c++) {
+            if (*c == '"' || *c == '\\') out << '\\';
+            out << *c;
+        }
+    }
+
+public:
+    static std::atomic<bool> enabled;
+
+    static uint64_t now() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+
+    static void setThreadName(const char* name) {
+        TraceBuffer* buffer = local ? local : registerThread();
+        buffer->threadName = name;
+    }
+
+    static void record(const char* name, const char* category, char phase, uint64_t tsNs,
+                       uint64_t durNs = 0, uint64_t id = 0, uint64_t value = 0) {
+        if (!enabled.load(std::memory_order_relaxed)) return;
+        TraceBuffer* buffer = local ? local : registerThread();
+        if (buffer->count == TraceBuffer::CAPACITY) {
+            buffer->dropped++;
+            return;
+        }
+        TraceEvent& e = buffer->events[buffer->count++];
+        std::strncpy(e.name, name, sizeof(e.name) - 1);
+        e.name[sizeof(e.name) - 1] = '\0';
+        e.category = category;
+        e.phase = phase;
+        e.tsNs = tsNs;
+        e.durNs = durNs;
+        e.id = id;
+        e.value = value;
+    }
+
+    // Writes every buffer as Chrome trace JSON. Call once all traced threads have finished.
+    static bool flush(const char* path) {
+        std::ofstream out(path);
+        if (!out) return false;
+        // Microseconds with 3 decimals (= ns resolution); the default 6 digits would switch to
+        // 1.23457e+06 after one second and blur the timeline
+        out << std::fixed << std::setprecision(3);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t total = 0, dropped = 0;
+        bool first = true;
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        for (const std::unique_ptr<TraceBuffer>& buffer : buffers) {
+            // Metadata event so the timeline shows thread names instead of numbers
+            out << (first ? "" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":"
+                << buffer->threadIndex << ",\"args\":{\"name\":\"";
+            writeEscaped(out, buffer->threadName.c_str());
+            out << "\"}}";
+            first = false;
+
+            for (size_t i = 0; i < buffer->count; i++) {
+                const TraceEvent& e = buffer->events[i];
+                out << ",\n{\"name\":\"";
+                writeEscaped(out, e.name);
+                out << "\",\"cat\":\"" << e.category << "\",\"ph\":\"" << e.phase << "\",\"pid\":1,\"tid\":"
+                    << buffer->threadIndex << ",\"ts\":" << e.tsNs / 1000.0; // Chrome wants microseconds
+                if (e.phase == 'X') out << ",\"dur\":" << e.durNs / 1000.0;
+                if (e.phase == 'b' || e.phase == 'e') out << ",\"id\":" << e.id;
+                if (e.phase == 'C') out << ",\"args\":{\"value\":" << e.value << "}";
+                out << "}";
+            }
+            total += buffer->count;
+            dropped += buffer->dropped;
+        }
+        out << "\n]}\n";
+        std::cout << "[Trace] " << total << " events written to " << path;
+        if (dropped) std::cout << " (" << dropped << " dropped, buffers full)";
+        std::cout << "\n";
+        return true;
+    }
+};
+
+std::mutex Tracer::mutex;
+std::vector<std::unique_ptr<TraceBuffer>> Tracer::buffers;
+thread_local TraceBuffer* Tracer::local = nullptr;
+const std::chrono::steady_clock::time_point Tracer::start = std::chrono::steady_clock::now();
+std::atomic<bool> Tracer::enabled{true};
+
+// Records a span from construction to destruction ("RAII" - the destructor always runs)
+class TraceSpan {
+private:
+    const char* name;
+    const char* category;
+    uint64_t begin;
+public:
+    TraceSpan(const char* name, const char* category) : name(name), category(category), begin(Tracer::now()) {}
+    ~TraceSpan() {
+        Tracer::record(name, category, 'X', begin, Tracer::now() - begin);
+    }
+};
+
+// ============================================================
+// Character (from i5) with lifetime events instead of console text
+// ============================================================
+std::atomic<uint64_t> nextObjectId{1};
+
+class Character {
+private:
+    std::string name;
+    int level;
+    uint64_t traceId; // pairs the "entered" and "left" events of THIS object
+public:
+    Character(std::string name) : name(std::move(name)), level(1), traceId(nextObjectId++) {
+        Tracer::record(this->name.c_str(), "lifetime", 'b', Tracer::now(), 0, traceId);
+    }
+    ~Character() {
+        Tracer::record(name.c_str(), "lifetime", 'e', Tracer::now(), 0, traceId);
+    }
+
+    // Lifetime events are per object, so copies would need their own ids - keep it simple
+    Character(const Character&) = delete;
+    Character& operator=(const Character&) = delete;
+
+    void attack() {
+        TraceSpan span("attack", "npc");
+        std::this_thread::sleep_for(std::chrono::microseconds(200)); // pretend to work
+    }
+
+    void increaseLevel(int levelCoin) {
+        level += levelCoin;
+    }
+
+    int getLevel() const {
+        return level;
+    }
+
+    const std::string& getName() const {
+        return name;
+    }
+};
+
+void levelUp(Character* _char, int* coin) {
+    TraceSpan span("levelUp", "npc");
+    _char->increaseLevel(*coin);
+}
+
+// ============================================================
+// LED register (from i6) with a counter event per write
+// ============================================================
+uint32_t fakeRegister = 0;
+
+void updateLED(volatile uint32_t* reg, uint32_t v) {
+    *reg = v; // Writing to the memory-mapped register
+    Tracer::record("fakeRegister", "register", 'C', Tracer::now(), 0, 0, v);
+}
+
+
+int main(int argc, char* argv[]) {
+    const char* path = (argc > 1) ? argv[1] : "trace_i11.json";
+    Tracer::setThreadName("main (party)");
+
+    // A second thread blinks the LED, so the timeline shows two per-thread buffers
+    std::thread ledThread([] {
+        Tracer::setThreadName("led");
+        volatile uint32_t* regPtr = &fakeRegister;
+        for (int i = 0; i < 10; i++) {
+            updateLED(regPtr, i & 1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    // The i5 scenario
+    int levelCoin = 5;
+    int* levelPtr = &levelCoin;
+    void (*levelTrigger)(Character*, int*) = levelUp;
+
+    Character* hero = new Character("Warrior");
+    hero->attack();
+    levelTrigger(hero, levelPtr);
+
+    Character* party = new Character[2] { {"Mage"}, {"Archer"} };
+    for (int i = 0; i < 2; i++) {
+        (party + i)->attack();
+        *levelPtr = 2;
+        levelTrigger((party + i), levelPtr);
+    }
+
+    delete hero;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2)); // the party outlives the hero
+    delete[] party;
+
+    ledThread.join(); // every traced thread must finish before flushing
+    if (!Tracer::flush(path)) {
+        std::cout << "[Trace] Could not write " << path << "\n";
+        return 1;
+    }
+    std::cout << "[Trace] Open it in https://ui.perfetto.dev or chrome://tracing\n";
+
+    return 0;
+}
@@ -0,0 +1,340 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i12_register_write_queue.cpp
+ * Description:
+ *   A traced register-access layer that queues writes, coalesces bit
+ *   set/clear operations per register and flushes them at explicit barriers.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    In i6, updateLED() writes the register, reads it back to pick the console color and
+    displayLED() reads it AGAIN - 3 volatile accesses to change one bit. On real hardware every
+    one of those is a bus transaction, far slower than a normal memory access.
+
+    Drivers usually change registers bit by bit (read-modify-write):
+        reg = reg | ENABLE;   -> 1 read + 1 write
+        reg = reg & ~IRQ;     -> 1 read + 1 write   (same register, again)
+
+    The QueuedRegisters layer below:
+        - QUEUES writes instead of touching the register right away
+        - COALESCES bit set/clear operations on the same register into ONE final store
+        - answers reads of a queued register from the queue (no bus access)
+        - FLUSHES everything at barrier(), which the driver calls where order matters
+          ("the device must see the config before we press START")
+
+    When NOT to queue:
+        Registers that change by themselves (status flags), FIFOs where every write counts, or
+        "write 1 to clear" registers. For those call barrier() and use the bus directly.
+
+    Every real access goes through RegisterBus, which counts it and can log it (the trace).
+
+    Usage:
+        ./i12_register_write_queue [operations, default 1048576]
+*/
+
+#include <iostream>
+#include <iomanip>    // For std::setw, std::hex
+#include <cstdint>    // For fixed-width integer types
+#include <cstdlib>    // For std::strtoull
+#include <vector>
+#include <random>     // For std::mt19937
+#include <chrono>     // For timing
+
+constexpr size_t REGISTER_COUNT = 1024;
+
+// Simulating a bank of hardware registers (instead of real memory-mapped addresses)
+uint32_t fakeRegisters[REGISTER_COUNT] = {};
+
+// ============================================================
+// Bus - the only place that touches the volatile registers
+// ============================================================
+struct RegisterAccess {
+    char kind;       // 'R' or 'W'
+    uint16_t index;
+    uint32_t value;
+};
+
+class RegisterBus {
+private:
+    volatile uint32_t* base;
+public:
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    bool tracing = false;              // log every access, not just count it
+    std::vector<RegisterAccess> trace;
+
+    RegisterBus(volatile uint32_t* base) : base(base) {}
+
+    uint32_t read(uint16_t index) {
+        uint32_t value = base[index];
+        reads++;
+        if (tracing) trace.push_back({'R', index, value});
+        return value;
+    }
+
+    void write(uint16_t index, uint32_t value) {
+        base[index] = value;
+        writes++;
+        if (tracing) trace.push_back({'W', index, value});
+    }
+
+    void printTrace() const {
+        for (const RegisterAccess& a : trace) {
+            std::cout << "[Trace] " << a.kind << " reg[" << a.index << "] "
+                      << (a.kind == 'W' ? "<- 0x" : "-> 0x") << std::hex << a.value << std::dec << "\n";
+        }
+    }
+};
+
+// ============================================================
+// Direct access - every call goes straight to the bus (what i6 does)
+// ============================================================
+class DirectRegisters {
+private:
+    RegisterBus& bus;
+public:
+    DirectRegisters(RegisterBus& bus) : bus(bus) {}
+
+    uint32_t read(uint16_t index) { return bus.read(index); }
+    void write(uint16_t index, uint32_t value) { bus.write(index, value); }
+    void setBits(uint16_t index, uint32_t mask) { bus.write(index, bus.read(index) | mask); }
+    void clearBits(uint16_t index, uint32_t mask) { bus.write(index, bus.read(index) & ~mask); }
+    void barrier() {} // nothing is ever pending
+};
+
+// ============================================================
+// Queued access - writes wait for barrier(), one store per register
+// ============================================================
+class QueuedRegisters {
+private:
+    // What we will do to one register at the next barrier:
+    //   fullWrite  -> store "value" (no read needed)
+    //   otherwise  -> read it, clear "clearMask", set "setMask", store it
+    struct Pending {
+        uint32_t value;
+        uint32_t setMask;
+        uint32_t clearMask;
+        bool fullWrite;
+    };
+
+    RegisterBus& bus;
+    Pending pending[REGISTER_COUNT];
+    bool dirty[REGISTER_COUNT] = {};
+    std::vector<uint16_t> order;     // dirty registers in first-touched order, flushed in that order
+
+    Pending& slot(uint16_t index) {
+        if (!dirty[index]) {
+            dirty[index] = true;
+            pending[index] = {0, 0, 0, false};
+            order.push_back(index);
+        }
+        return pending[index];
+    }
+
+public:
+    QueuedRegisters(RegisterBus& bus) : bus(bus) { order.reserve(REGISTER_COUNT); }
+    ~QueuedRegisters() { barrier(); } // never lose a queued write
+
+    // The queue points into "bus" and owns pending writes, so it can't be copied
+    QueuedRegisters(const QueuedRegisters&) = delete;
+    QueuedRegisters& operator=(const QueuedRegisters&) = delete;
+
+    void write(uint16_t index, uint32_t value) {
+        Pending& p = slot(index);
+        p.value = value;
+        p.setMask = p.clearMask = 0; // a full write replaces all earlier bit operations
+        p.fullWrite = true;
+    }
+
+    void setBits(uint16_t index, uint32_t mask) {
+        Pending& p = slot(index);
+        if (p.fullWrite) {
+            p.value |= mask;
+        } else {
+            p.setMask |= mask;
+            p.clearMask &= ~mask; // the later operation wins
+        }
+    }
+
+    void clearBits(uint16_t index, uint32_t mask) {
+        Pending& p = slot(index);
+        if (p.fullWrite) {
+            p.value &= ~mask;
+        } else {
+            p.clearMask |= mask;
+            p.setMask &= ~mask;
+        }
+    }
+
+    // Sees queued writes. A register with only bit operations pending is read ONCE and turned
+    // into a full write, so later reads and the flush need no bus read.
+    uint32_t read(uint16_t index) {
+        if (!dirty[index]) return bus.read(index);
+        Pending& p = pending[index];
+        if (!p.fullWrite) {
+            p.value = (bus.read(index) & ~p.clearMask) | p.setMask;
+            p.setMask = p.clearMask = 0;
+            p.fullWrite = true;
+        }
+        return p.value;
+    }
+
+    // Everything queued reaches the registers before this returns
+    void barrier() {
+        for (uint16_t index : order) {
+            Pending& p = pending[index];
+            uint32_t value = p.fullWrite ? p.value : (bus.read(index) & ~p.clearMask) | p.setMask;
+            bus.write(index, value);
+            dirty[index] = false;
+        }
+        order.clear();
+    }
+
+    size_t queued() const { return order.size(); }
+};
+
+// ============================================================
+// The i6 LED, on both layers
+// ============================================================
+template <typename Registers>
+void updateLED(Registers& regs, uint32_t v) {
+    regs.write(0, v);                                      // write the LED register
+    bool colorOn = regs.read(0) & 0x01;                    // read back for the console color
+    bool displayOn = regs.read(0) & 0x01;                  // displayLED() reads it again
+    std::cout << "[System] LED " << (colorOn && displayOn ? "ON" : "OFF") << "\n";
+}
+
+void ledExample() {
+    RegisterBus bus(fakeRegisters);
+    bus.tracing = true;
+
+    std::cout << "[System] Direct (i6):\n";
+    DirectRegisters direct(bus);
+    updateLED(direct, 0x01);
+    bus.printTrace();
+
+    std::cout << "[System] Queued, barrier after the update:\n";
+    bus.trace.clear();
+    QueuedRegisters queued(bus);
+    updateLED(queued, 0x00);
+    queued.barrier();
+    bus.printTrace();
+}
+
+// ============================================================
+// Benchmark - random bit operations on the 1024-register bank
+// ============================================================
+using Clock = std::chrono::steady_clock;
+
+// The simulated registers are plain (cached) memory, so a volatile access costs about as much as
+// any other store and the direct layer's raw Mops/s looks great. A real peripheral bus access
+// takes roughly this long, the "Mops/s @bus" column adds it per access.
+constexpr double BUS_ACCESS_NS = 100.0;
+
+struct Op {
+    uint16_t index;
+    uint8_t kind;   // 0 write, 1 read, 2 set bits, 3 clear bits
+    uint32_t value;
+};
+
+// "localized": each batch works on one 8-register peripheral most of the time, like a driver
+// configuring a device. "uniform": any register, the worst case for coalescing.
+std::vector<Op> makeOps(size_t count, size_t batch, bool localized, std::mt19937& rng) {
+    std::vector<Op> ops(count);
+    uint16_t peripheral = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i % batch == 0) peripheral = (uint16_t)(rng() % (REGISTER_COUNT / 8) * 8);
+        Op& op = ops[i];
+        op.index = (localized && rng() % 10 < 9) ? (uint16_t)(peripheral + rng() % 8) : (uint16_t)(rng() % REGISTER_COUNT);
+        uint32_t r = rng() % 10;
+        op.kind = (r == 0) ? 0 : (r == 1) ? 1 : (r < 6) ? 2 : 3;
+        op.value = (op.kind == 0) ? (uint32_t)rng() : 1u << (rng() % 32);
+    }
+    return ops;
+}
+
+struct Result {
+    uint64_t reads, writes, readSum;
+    double seconds;
+};
+
+template <typename Registers>
+Result run(const std::vector<Op>& ops, size_t batch) {
+    for (uint32_t& reg : fakeRegisters) reg = 0; // same starting state for both layers
+    RegisterBus bus(fakeRegisters);
+    uint64_t readSum = 0;
+
+    Clock::time_point start = Clock::now();
+    {
+        Registers regs(bus);
+        for (size_t i = 0; i < ops.size(); i++) {
+            const Op& op = ops[i];
+            switch (op.kind) {
+                case 0: regs.write(op.index, op.value); break;
+                case 1: readSum += regs.read(op.index); break;
+                case 2: regs.setBits(op.index, op.value); break;
+                default: regs.clearBits(op.index, op.value); break;
+            }
+            if ((i + 1) % batch == 0) regs.barrier();
+        }
+        regs.barrier();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return {bus.reads, bus.writes, readSum, seconds};
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : (1u << 20);
+    if (count == 0) count = 1;
+
+    ledExample();
+
+    std::mt19937 rng(42); // fixed seed so every run does the same work
+    const size_t batches[] = { 16, 64, 256 };
+    int failures = 0;
+
+    std::cout << "\n[Bench] " << count << " operations on " << REGISTER_COUNT << " registers, barrier every <batch> operations\n";
+    std::cout << std::setw(10) << "workload" << std::setw(7) << "batch" << std::setw(10) << "layer"
+              << std::setw(11) << "reads" << std::setw(11) << "writes" << std::setw(11) << "accesses"
+              << std::setw(9) << "Mops/s" << std::setw(13) << "Mops/s @bus" << "\n";
+
+    for (bool localized : { true, false }) {
+        for (size_t batch : batches) {
+            std::vector<Op> ops = makeOps(count, batch, localized, rng);
+            Result direct = run<DirectRegisters>(ops, batch);
+            std::vector<uint32_t> directBank(fakeRegisters, fakeRegisters + REGISTER_COUNT);
+            Result queued = run<QueuedRegisters>(ops, batch);
+
+            // Both layers must leave the bank in the same state and read the same values
+            bool same = directBank == std::vector<uint32_t>(fakeRegisters, fakeRegisters + REGISTER_COUNT)
+                        && direct.readSum == queued.readSum;
+            if (!same) failures++;
+
+            const char* workload = localized ? "localized" : "uniform";
+            for (const Result* r : { &direct, &queued }) {
+                std::cout << std::setw(10) << workload << std::setw(7) << batch
+                          << std::setw(10) << (r == &direct ? "direct" : "queued")
+                          << std::setw(11) << r->reads << std::setw(11) << r->writes
+                          << std::setw(11) << r->reads + r->writes
+                          << std::setw(9) << std::fixed << std::setprecision(1) << count / r->seconds / 1e6
+                          << std::setw(13) << count / (r->seconds + (r->reads + r->writes) * BUS_ACCESS_NS * 1e-9) / 1e6 << "\n";
+            }
+            std::cout << std::setw(27) << "" << "accesses saved: " << std::setprecision(1)
+                      << 100.0 * (1.0 - (double)(queued.reads + queued.writes) / (double)(direct.reads + direct.writes))
+                      << "%" << (same ? "" : "  [FAIL] final register state differs!") << "\n";
+        }
+    }
+
+    std::cout << (failures ? "[System] Queued writes changed the result!\n" : "[System] Queued and direct results match.\n");
+    return failures ? 1 : 0;
+}
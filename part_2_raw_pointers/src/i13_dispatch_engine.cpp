@@ -0,0 +1,362 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i13_dispatch_engine.cpp
+ * Description:
+ *   Mage, archer and warrior NPC behaviors dispatched through virtual calls,
+ *   function pointers, std::variant and type-sorted batches, benchmarked on
+ *   a million mixed NPCs with branch-miss counts.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    i5 has one kind of Character. A game has many: mages, archers, warriors - each acting
+    differently every frame. "Which code runs for THIS npc?" is called DISPATCH, and there
+    are several ways to do it:
+
+        virtual        Npc* -> vtable pointer -> function. One indirect call per npc.
+        function ptr   every record stores its own function pointer (i3/i5 style).
+        std::variant   the npc is stored by value with a type index, std::visit picks the code.
+        sorted         the virtual engine again, but the npcs are ordered by type.
+        batched        one array per type, loop over each array. No dispatch left at all.
+
+    Why it matters:
+        The CPU guesses the target of every indirect call and branch before it knows it
+        (BRANCH PREDICTION). In a randomly mixed array the guess is wrong about 2 out of 3
+        times, and every wrong guess throws away ~15-20 cycles of work. Sorting or batching by
+        type makes the target the same for long runs, so the guess is almost always right.
+
+    All engines call the SAME behavior functions on the SAME npcs, only the dispatch differs.
+    The total damage must match between engines, otherwise the program exits with 1.
+
+    Branch misses are read from the Linux perf counters. They show "n/a" on other systems, or
+    when perf is not allowed (perf_event_paranoid, containers).
+
+    Usage:
+        ./i13_dispatch_engine [npcs, default 1000000] [frames, default 10]
+*/
+
+#include <iostream>
+#include <iomanip>    // For std::setw
+#include <cstdint>    // For fixed-width integer types
+#include <cstdlib>    // For std::strtoull
+#include <vector>
+#include <variant>    // For std::variant and std::visit
+#include <random>     // For std::mt19937
+#include <algorithm>  // For std::stable_sort
+#include <chrono>     // For timing
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// Unoptimized builds don't inline std::visit or the batch loops, which flips the ranking
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && !defined(_DEBUG))
+    constexpr bool OPTIMIZED_BUILD = true;
+#else
+    constexpr bool OPTIMIZED_BUILD = false;
+#endif
+
+// ============================================================
+// Behaviors - shared by every engine
+// ============================================================
+struct Stats {
+    uint32_t level;
+    uint32_t resource; // mana, arrows or rage
+};
+
+// Each returns the damage dealt this frame
+uint32_t mageAct(Stats& s) {
+    if (s.resource >= 10) {
+        s.resource -= 10;
+        return 3 * s.level;      // fireball
+    }
+    s.resource += 4;             // regenerate mana
+    return 0;
+}
+
+uint32_t archerAct(Stats& s) {
+    if (s.resource > 0) {
+        s.resource--;
+        return 2 * s.level + 1;  // shoot
+    }
+    s.resource = 5;              // reload
+    return 0;
+}
+
+uint32_t warriorAct(Stats& s) {
+    s.resource += 3;
+    if (s.resource >= 9) {
+        uint32_t damage = s.resource; // unleash the rage
+        s.resource = 0;
+        return damage;
+    }
+    return 1;
+}
+
+enum class NpcKind : uint8_t { Mage, Archer, Warrior };
+
+struct Spawn {
+    NpcKind kind;
+    Stats stats;
+};
+
+// ============================================================
+// Engine 1 - virtual dispatch through Npc*
+// ============================================================
+class Npc {
+public:
+    Stats stats;
+    Npc(Stats stats) : stats(stats) {}
+    virtual ~Npc() = default;
+    virtual uint32_t act() = 0;
+};
+
+class MageNpc : public Npc {
+public:
+    using Npc::Npc;
+    uint32_t act() override { return mageAct(stats); }
+};
+
+class ArcherNpc : public Npc {
+public:
+    using Npc::Npc;
+    uint32_t act() override { return archerAct(stats); }
+};
+
+class WarriorNpc : public Npc {
+public:
+    using Npc::Npc;
+    uint32_t act() override { return warriorAct(stats); }
+};
+
+// The caller owns the returned npcs and must delete them
+std::vector<Npc*> makeVirtual(const std::vector<Spawn>& spawns) {
+    std::vector<Npc*> npcs;
+    npcs.reserve(spawns.size());
+    for (const Spawn& s : spawns) {
+        switch (s.kind) {
+            case NpcKind::Mage: npcs.push_back(new MageNpc(s.stats)); break;
+            case NpcKind::Archer: npcs.push_back(new ArcherNpc(s.stats)); break;
+            case NpcKind::Warrior: npcs.push_back(new WarriorNpc(s.stats)); break;
+        }
+    }
+    return npcs;
+}
+
+// ============================================================
+// Engine 2 - a function pointer in every record
+// ============================================================
+struct NpcRecord {
+    uint32_t (*act)(Stats&);
+    Stats stats;
+};
+
+uint32_t (*const actTable[])(Stats&) = { mageAct, archerAct, warriorAct }; // indexed by NpcKind
+
+// ============================================================
+// Engine 3 - std::variant, stored by value
+// ============================================================
+struct Mage    { Stats stats; uint32_t act() { return mageAct(stats); } };
+struct Archer  { Stats stats; uint32_t act() { return archerAct(stats); } };
+struct Warrior { Stats stats; uint32_t act() { return warriorAct(stats); } };
+using NpcVariant = std::variant<Mage, Archer, Warrior>;
+
+// ============================================================
+// Engine 4 - one array per type
+// ============================================================
+struct NpcBatches {
+    std::vector<Stats> mages;
+    std::vector<Stats> archers;
+    std::vector<Stats> warriors;
+};
+
+// ============================================================
+// Branch-miss counter (Linux perf), "n/a" when unavailable
+// ============================================================
+class BranchMissCounter {
+private:
+    int fd = -1;
+public:
+    BranchMissCounter() {
+    #ifdef __linux__
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1; // only our own code
+        attr.exclude_hv = 1;
+        fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0); // this thread, any CPU
+    #endif
+    }
+    ~BranchMissCounter() {
+    #ifdef __linux__
+        if (fd >= 0) close(fd);
+    #endif
+    }
+    BranchMissCounter(const BranchMissCounter&) = delete;
+    BranchMissCounter& operator=(const BranchMissCounter&) = delete;
+
+    bool available() const { return fd >= 0; }
+
+    void start() {
+    #ifdef __linux__
+        if (fd < 0) return;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    #endif
+    }
+
+    // Branch misses since start(), or -1 when unavailable
+    long long stop() {
+    #ifdef __linux__
+        if (fd < 0) return -1;
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) return -1;
+        return count;
+    #else
+        return -1;
+    #endif
+    }
+};
+
+// ============================================================
+// Benchmark
+// ============================================================
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    uint64_t damage;
+    double seconds;
+    long long branchMisses;
+};
+
+// Runs "frame" (one update of every npc, returns its damage) "frames" times
+template <typename Frame>
+Result measure(BranchMissCounter& counter, size_t frames, Frame frame) {
+    uint64_t damage = 0;
+    counter.start();
+    Clock::time_point start = Clock::now();
+    for (size_t f = 0; f < frames; f++) damage += frame();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return {damage, seconds, counter.stop()};
+}
+
+int main(int argc, char* argv[]) {
+    size_t npcCount = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t frames = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 10;
+    if (npcCount == 0) npcCount = 1;
+    if (frames == 0) frames = 1;
+
+    // The same randomly mixed population for every engine
+    std::mt19937 rng(42);
+    std::vector<Spawn> spawns(npcCount);
+    for (Spawn& s : spawns) {
+        s.kind = (NpcKind)(rng() % 3);
+        s.stats = { 1 + (uint32_t)(rng() % 50), (uint32_t)(rng() % 10) };
+    }
+    std::vector<Spawn> sortedSpawns = spawns;
+    std::stable_sort(sortedSpawns.begin(), sortedSpawns.end(),
+                     [](const Spawn& a, const Spawn& b) { return a.kind < b.kind; });
+
+    std::vector<Npc*> mixedNpcs = makeVirtual(spawns);
+    std::vector<Npc*> sortedNpcs = makeVirtual(sortedSpawns);
+
+    std::vector<NpcRecord> records;
+    std::vector<NpcVariant> variants;
+    NpcBatches batches;
+    records.reserve(npcCount);
+    variants.reserve(npcCount);
+    for (const Spawn& s : spawns) {
+        records.push_back({ actTable[(int)s.kind], s.stats });
+        switch (s.kind) {
+            case NpcKind::Mage: variants.emplace_back(Mage{s.stats}); batches.mages.push_back(s.stats); break;
+            case NpcKind::Archer: variants.emplace_back(Archer{s.stats}); batches.archers.push_back(s.stats); break;
+            case NpcKind::Warrior: variants.emplace_back(Warrior{s.stats}); batches.warriors.push_back(s.stats); break;
+        }
+    }
+
+    BranchMissCounter counter;
+    struct Row { const char* name; Result result; };
+    std::vector<Row> rows;
+
+    rows.push_back({ "virtual", measure(counter, frames, [&] {
+        uint64_t damage = 0;
+        for (Npc* npc : mixedNpcs) damage += npc->act();
+        return damage;
+    }) });
+
+    rows.push_back({ "function ptr", measure(counter, frames, [&] {
+        uint64_t damage = 0;
+        for (NpcRecord& r : records) damage += r.act(r.stats);
+        return damage;
+    }) });
+
+    rows.push_back({ "std::variant", measure(counter, frames, [&] {
+        uint64_t damage = 0;
+        for (NpcVariant& v : variants) damage += std::visit([](auto& npc) { return npc.act(); }, v);
+        return damage;
+    }) });
+
+    rows.push_back({ "virtual sorted", measure(counter, frames, [&] {
+        uint64_t damage = 0;
+        for (Npc* npc : sortedNpcs) damage += npc->act();
+        return damage;
+    }) });
+
+    rows.push_back({ "batched", measure(counter, frames, [&] {
+        uint64_t damage = 0;
+        for (Stats& s : batches.mages) damage += mageAct(s);
+        for (Stats& s : batches.archers) damage += archerAct(s);
+        for (Stats& s : batches.warriors) damage += warriorAct(s);
+        return damage;
+    }) });
+
+    double updates = (double)npcCount * (double)frames;
+    if (!OPTIMIZED_BUILD) {
+        std::cout << "[Warning] Built without optimizations, these numbers do not reflect a real build. "
+                     "Use -O2 or CMAKE_BUILD_TYPE=Release.\n";
+    }
+    std::cout << "[Bench] " << npcCount << " mixed npcs x " << frames << " frames"
+              << (counter.available() ? "" : " (branch misses n/a: perf counters unavailable)") << "\n";
+    std::cout << std::setw(16) << "engine" << std::setw(10) << "ms" << std::setw(14) << "M updates/s"
+              << std::setw(16) << "misses/update" << std::setw(16) << "damage" << "\n";
+
+    int failures = 0;
+    for (const Row& row : rows) {
+        std::cout << std::setw(16) << row.name << std::fixed << std::setprecision(1)
+                  << std::setw(10) << row.result.seconds * 1000.0
+                  << std::setw(14) << updates / row.result.seconds / 1e6;
+        if (row.result.branchMisses >= 0) {
+            std::cout << std::setw(16) << std::setprecision(3) << row.result.branchMisses / updates;
+        } else {
+            std::cout << std::setw(16) << "n/a";
+        }
+        std::cout << std::setw(16) << row.result.damage;
+        if (row.result.damage != rows[0].result.damage) {
+            std::cout << "  [FAIL] damage differs from virtual";
+            failures++;
+        }
+        std::cout << "\n";
+    }
+
+    // We created the virtual npcs with new, so we delete them
+    for (Npc* npc : mixedNpcs) delete npc;
+    for (Npc* npc : sortedNpcs) delete npc;
+
+    std::cout << (failures ? "[System] Engines disagree!\n" : "[System] All engines dealt the same damage.\n");
+    return failures ? 1 : 0;
+}
@@ -12,10 +12,12 @@
  * Version: v1.0.0
  * Author: Ghost
  * Created On: 03-06-2025
- * Last Modified: 03-06-2025
+ * Last Modified: 10-19-2026
  *****************************************************************************/
 
 #include <iostream>
+#include <string>
+#include <utility>  // For std::move
 
 /* Information..
 
@@ -33,13 +35,23 @@ private:
     std::string name;
     int level;
 public:
-    Character(std::string name) : name(name), level(1) {
-        std::cout << "[System] " << name << " has entered the game!\n";
+    // "name" is taken by value and MOVED into the member, so a temporary or std::move'd string
+    // is never copied (see i10_character_moves.cpp). After the move the parameter's value is
+    // unspecified (don't use it), which is why the message below uses "this->name".
+    Character(std::string name) : name(std::move(name)), level(1) {
+        std::cout << "[System] " << this->name << " has entered the game!\n";
     }
     ~Character() {
         std::cout << "[System] "  << name << " has left the game.\n";
     }
 
+    // Declaring a destructor switches off the automatic move operations, so ask for them back.
+    // "noexcept" lets containers move (not copy) characters when they grow.
+    Character(const Character&) = default;
+    Character& operator=(const Character&) = default;
+    Character(Character&&) noexcept = default;
+    Character& operator=(Character&&) noexcept = default;
+
     // Methods
     void attack() {
         std::cout << " --> " << name << " attacks the enemy!\n";
@@ -54,7 +66,7 @@ public:
         return level;
     }
 
-    std::string getName() const {
+    const std::string& getName() const { // reference to the member, no copy
         return name;
     }
 };
@@ -96,7 +108,7 @@ int main() {
     levelTrigger(hero, levelPtr);  // Call function via pointer
 
     // 4) ARRAY POINTER(Heap) (Pointer to an array of Characters)
-    Character* party = new Character[2] { {"Mage"}, {"Archer"} };
+    Character* party = new Character[2] { {"Mage"}, {"Archer"} }; // each element is initialized from {"Mage"} by calling the constructor directly, no temporary Characters
 
     std::cout << "[System] " << "Party Members:\n";
     for (int i = 0; i < 2; i++) {
@@ -0,0 +1,368 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i7_simulation_loop.cpp
+ * Description:
+ *   A reusable fixed-timestep simulation loop that runs the NPC party (i5) and
+ *   the LED register (i6) as systems, with per-phase timing instrumentation.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    i5 and i6 run once, straight through main(), and i6 uses sleep_for() to pace itself.
+    Real programs (games, firmware, simulations) instead run a LOOP that "ticks" many times
+    per second. Every tick is split into phases and every system gets a turn in each phase:
+
+        input    -> collect what happened since the last tick (coins earned, button presses)
+        logic    -> advance the simulation by a FIXED amount of time (dt)
+        level-up -> apply the results (level coins) through a function pointer, like i5
+        output   -> print / write registers / draw
+
+    Fixed timestep with an accumulator:
+        Wall-clock time is added to an "accumulator". While the accumulator holds at least
+        one dt, we run one tick and subtract dt. The simulation itself only ever sees dt,
+        never the wall clock, so the same number of ticks ALWAYS produces the same state.
+        That is what makes the headless mode below deterministic.
+
+    Usage:
+        ./i7_simulation_loop                     -> real-time, 3 seconds at 60 ticks/sec
+        ./i7_simulation_loop --headless [ticks]  -> no sleeping, no printing, as fast as possible
+*/
+
+#include <iostream>
+#include <cstdint>    // For fixed-width integer types
+#include <cstdlib>    // For std::strtoull
+#include <cstring>    // For std::strcmp
+#include <string>
+#include <vector>
+#include <utility>    // For std::move
+#include <algorithm>  // For std::sort
+#include <thread>     // For sleep
+#include <chrono>     // For timing
+
+using Clock = std::chrono::steady_clock;
+
+// ============================================================
+// Phases and the System interface
+// ============================================================
+enum Phase { PHASE_INPUT, PHASE_LOGIC, PHASE_LEVEL_UP, PHASE_OUTPUT, PHASE_COUNT };
+
+const char* phaseNames[PHASE_COUNT] = { "input", "logic", "level-up", "output" };
+
+// Everything a system needs to know about the current tick
+struct TickContext {
+    uint64_t tick;  // tick number, starts at 0
+    double dt;      // fixed step in seconds - NEVER the measured frame time
+    bool headless;  // true when benchmarking, systems should not print
+};
+
+class System {
+public:
+    virtual ~System() = default;
+    virtual const char* getName() const = 0;
+
+    // Every phase has the same signature so the loop can store them in a table of
+    // pointers to member functions (see SimulationLoop::tick).
+    virtual void input(const TickContext&) {}
+    virtual void logic(const TickContext&) {}
+    virtual void levelUp(const TickContext&) {}
+    virtual void output(const TickContext&) {}
+
+    // Used to prove that two runs with the same tick count end in the same state
+    virtual uint64_t checksum() const = 0;
+};
+
+// ============================================================
+// Per-phase timing
+// ============================================================
+class PhaseTimer {
+private:
+    std::vector<uint32_t> samples; // nanoseconds, one sample per tick
+public:
+    void reserve(uint64_t ticks) { samples.reserve(ticks); } // reserve up front so ticks never allocate
+
+    void record(Clock::duration d) {
+        samples.push_back((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    }
+
+    // Returns the value below which "p" percent of the samples fall
+    double percentileMicros(const std::vector<uint32_t>& sorted, double p) const {
+        if (sorted.empty()) return 0.0;
+        size_t idx = (size_t)(p / 100.0 * (double)(sorted.size() - 1));
+        return sorted[idx] / 1000.0;
+    }
+
+    void report(const char* name) const {
+        std::vector<uint32_t> sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+        std::cout << "  " << name << "\t p50: " << percentileMicros(sorted, 50.0) << " us"
+                  << "\t p99: " << percentileMicros(sorted, 99.0) << " us"
+                  << "\t p99.9: " << percentileMicros(sorted, 99.9) << " us"
+                  << "\t max: " << percentileMicros(sorted, 100.0) << " us\n";
+    }
+};
+
+// ============================================================
+// The loop
+// ============================================================
+struct LoopConfig {
+    double tickRate = 60.0;     // ticks per simulated second
+    uint64_t maxTicks = 180;    // stop after this many ticks
+    bool headless = false;      // run ticks back to back, no sleeping, no printing
+    int maxCatchUpTicks = 5;    // cap per frame so a slow frame can't spiral
+};
+
+class SimulationLoop {
+private:
+    std::vector<System*> systems; // NOT owned - systems live in main()
+    PhaseTimer timers[PHASE_COUNT];
+    uint64_t ticksRun = 0;
+    double wallSeconds = 0.0;
+
+    void tick(const TickContext& ctx) {
+        /* Pointers to Member Functions
+            Just like "void (*levelTrigger)(Character*, int*)" in i5 points to a free function,
+            "void (System::*)(const TickContext&)" points to a member function of System.
+            It is called on an object with "(object->*fn)(args)". Because the phases are
+            virtual, the call still reaches the derived system's override.
+        */
+        static void (System::* const phaseFns[PHASE_COUNT])(const TickContext&) = {
+            &System::input, &System::logic, &System::levelUp, &System::output
+        };
+
+        for (int p = 0; p < PHASE_COUNT; p++) {
+            Clock::time_point start = Clock::now();
+            for (System* s : systems) {
+                (s->*phaseFns[p])(ctx);
+            }
+            timers[p].record(Clock::now() - start);
+        }
+    }
+
+public:
+    void addSystem(System* system) {
+        systems.push_back(system);
+    }
+
+    void run(const LoopConfig& config) {
+        const double dt = 1.0 / config.tickRate;
+        const Clock::duration step = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(dt));
+
+        for (PhaseTimer& t : timers) t.reserve(config.maxTicks);
+
+        Clock::time_point begin = Clock::now();
+        if (config.headless) {
+            // Headless: no accumulator needed, just tick as fast as possible
+            for (uint64_t i = 0; i < config.maxTicks; i++) {
+                tick({ ticksRun++, dt, true });
+            }
+        } else {
+            Clock::time_point previous = begin;
+            Clock::duration accumulator = step; // run the first tick immediately
+            while (ticksRun < config.maxTicks) {
+                Clock::time_point now = Clock::now();
+                accumulator += now - previous;
+                previous = now;
+
+                // Catch up on every whole step that has elapsed, but never more than the cap
+                int steps = 0;
+                while (accumulator >= step && steps < config.maxCatchUpTicks && ticksRun < config.maxTicks) {
+                    tick({ ticksRun++, dt, false });
+                    accumulator -= step;
+                    steps++;
+                }
+                if (steps == config.maxCatchUpTicks) accumulator = Clock::duration::zero(); // drop the backlog
+
+                // Sleep only until the next step is due (instead of a fixed sleep like i6)
+                if (accumulator < step) std::this_thread::sleep_for(step - accumulator);
+            }
+        }
+        wallSeconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    }
+
+    void report() const {
+        std::cout << "\n[Loop] " << ticksRun << " ticks in " << wallSeconds << " s -> "
+                  << (wallSeconds > 0.0 ? ticksRun / wallSeconds : 0.0) << " ticks/sec\n";
+        std::cout << "[Loop] Phase latency (all systems, per tick):\n";
+        for (int p = 0; p < PHASE_COUNT; p++) {
+            timers[p].report(phaseNames[p]);
+        }
+        for (const System* s : systems) {
+            std::cout << "[Loop] " << s->getName() << " state checksum: " << s->checksum() << "\n";
+        }
+    }
+};
+
+// ============================================================
+// System 1: NPC party (from i5_npc_example.cpp)
+// ============================================================
+class Character {
+private:
+    std::string name;
+    int level;
+    double cooldown; // seconds until the next attack
+public:
+    Character(std::string name) : name(std::move(name)), level(1), cooldown(0.0) {}
+
+    bool tickCooldown(double dt, double attackInterval) {
+        cooldown -= dt;
+        if (cooldown > 0.0) return false;
+        cooldown += attackInterval;
+        return true; // ready to attack
+    }
+
+    void increaseLevel(int levelCoin) {
+        level += levelCoin;
+    }
+
+    // Getters
+    int getLevel() const {
+        return level;
+    }
+
+    const std::string& getName() const {
+        return name;
+    }
+};
+
+// Same signature as i5's levelUp, used through a function pointer in the level-up phase
+void levelUp(Character* _char, int* coin) {
+    _char->increaseLevel(*coin);
+}
+
+class PartySystem : public System {
+private:
+    Character* party;      // heap array, like i5
+    int partySize;
+    int* attacks;          // attacks made per member this tick
+    int levelCoin = 0;     // coins earned during input, spent during level-up
+    uint64_t totalAttacks = 0;
+    void (*levelTrigger)(Character*, int*) = ::levelUp; // "::" picks the free function, not our method
+
+    static constexpr double attackInterval = 1.0; // seconds between attacks
+    static constexpr uint64_t coinEveryTicks = 45;
+public:
+    PartySystem() : partySize(3) {
+        party = new Character[3] { {"Warrior"}, {"Mage"}, {"Archer"} };
+        attacks = new int[3] {};
+    }
+    ~PartySystem() {
+        delete[] party;
+        delete[] attacks;
+    }
+
+    // A copy would share both arrays and delete them twice, so PartySystem can't be copied
+    PartySystem(const PartySystem&) = delete;
+    PartySystem& operator=(const PartySystem&) = delete;
+
+    const char* getName() const override { return "party"; }
+
+    void input(const TickContext& ctx) override {
+        // A coin drops on a fixed schedule, measured in ticks so it is deterministic
+        if (ctx.tick % coinEveryTicks == 0) levelCoin += 1;
+    }
+
+    void logic(const TickContext& ctx) override {
+        for (int i = 0; i < partySize; i++) {
+            attacks[i] = (party + i)->tickCooldown(ctx.dt, attackInterval) ? 1 : 0;
+            totalAttacks += attacks[i];
+        }
+    }
+
+    void levelUp(const TickContext& ctx) override {
+        if (levelCoin == 0) return;
+        for (int i = 0; i < partySize; i++) {
+            levelTrigger(party + i, &levelCoin);
+        }
+        if (!ctx.headless) std::cout << "[LEVEL COIN] Party spent " << levelCoin << " coin(s) at tick " << ctx.tick << "\n";
+        levelCoin = 0;
+    }
+
+    void output(const TickContext& ctx) override {
+        if (ctx.headless) return;
+        for (int i = 0; i < partySize; i++) {
+            if (attacks[i]) {
+                std::cout << " --> " << (party + i)->getName() << " (lvl " << (party + i)->getLevel() << ") attacks the enemy!\n";
+            }
+        }
+    }
+
+    uint64_t checksum() const override {
+        uint64_t sum = totalAttacks;
+        for (int i = 0; i < partySize; i++) sum = sum * 31 + (uint64_t)(party + i)->getLevel();
+        return sum;
+    }
+};
+
+// ============================================================
+// System 2: LED register (from i6_real_world_simulate.cpp)
+// ============================================================
+uint32_t fakeRegister = 0; // Simulating a hardware register
+
+class LedSystem : public System {
+private:
+    volatile uint32_t* reg;  // raw pointer to the "memory-mapped" register
+    bool wantOn = false;     // decided during input
+    bool changed = false;    // set during logic, consumed during output
+    uint64_t writes = 0;
+
+    static constexpr uint64_t blinkEveryTicks = 30;
+public:
+    LedSystem(volatile uint32_t* reg) : reg(reg) {}
+
+    const char* getName() const override { return "led"; }
+
+    void input(const TickContext& ctx) override {
+        if (ctx.tick % blinkEveryTicks == 0) wantOn = !wantOn; // "button press"
+    }
+
+    void logic(const TickContext&) override {
+        uint32_t value = wantOn ? 0x01 : 0x00;
+        changed = ((*reg & 0x01) != value);
+        if (changed) {
+            *reg = value; // write the register only when the state actually changes
+            writes++;
+        }
+    }
+
+    void output(const TickContext& ctx) override {
+        if (ctx.headless || !changed) return;
+        std::cout << ((*reg & 0x01) ? "💡 LED ON\n" : "❌ LED OFF\n");
+    }
+
+    uint64_t checksum() const override {
+        return writes * 2 + (*reg & 0x01);
+    }
+};
+
+
+int main(int argc, char* argv[]) {
+    LoopConfig config;
+    if (argc > 1 && std::strcmp(argv[1], "--headless") == 0) {
+        config.headless = true;
+        config.maxTicks = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    }
+
+    // Systems live on the stack of main(), the loop only holds pointers to them
+    PartySystem party;
+    LedSystem led(&fakeRegister);
+
+    SimulationLoop loop;
+    loop.addSystem(&party);
+    loop.addSystem(&led);
+
+    std::cout << "[System] Running " << config.maxTicks << " ticks at " << config.tickRate << " ticks/sec"
+              << (config.headless ? " (headless)" : "") << "...\n";
+    loop.run(config);
+    loop.report();
+
+    return 0;
+}
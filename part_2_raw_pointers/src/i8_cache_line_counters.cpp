@@ -0,0 +1,289 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i8_cache_line_counters.cpp
+ * Description:
+ *   Cache-line padded counters, registers and sharded counters, plus a layout
+ *   audit and a benchmark that measures false sharing between adjacent fields.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    Memory is not moved between RAM and the CPU one byte at a time. It moves in blocks
+    called CACHE LINES (64 bytes on most x86 and ARM chips). Every core keeps its own copy
+    of the lines it is using, and when one core WRITES to a line, every other core's copy
+    of that whole line is thrown away.
+
+    False Sharing:
+        Two threads write two DIFFERENT variables, so there is no data race... but the two
+        variables sit next to each other in memory, inside the SAME cache line. Every write
+        by one thread invalidates the line for the other, and the line ping-pongs between
+        cores. The program is correct, just many times slower.
+
+        struct Counters {                 address:  0         8         16 ... 63
+            std::atomic<uint64_t> a;               [ a       ][ b       ][ ...      ]
+            std::atomic<uint64_t> b;               <-------- one cache line -------->
+        };
+
+    The Fix:
+        Give each hot, independently written variable its own cache line with "alignas".
+        Pointers help us check this: the address of a field divided by the line size tells
+        us which line it lives on (see auditLayout below).
+
+    Usage:
+        ./i8_cache_line_counters [threads] [increments per thread]   (threads: 2..4, one per party member)
+
+    NOTE: false sharing needs at least two cores running at the same time. On a single
+    core machine every variant will report roughly the same speed.
+*/
+
+#include <iostream>
+#include <cstdint>    // For fixed-width integer types
+#include <cstddef>    // For offsetof
+#include <cstdlib>    // For std::strtoul
+#include <atomic>     // For thread safe counters
+#include <thread>
+#include <vector>
+#include <chrono>     // For timing
+
+// Most desktop and mobile CPUs use 64 byte lines. (Apple M-series prefetch in pairs, so
+// 128 can be even safer there.) C++17 offers std::hardware_destructive_interference_size,
+// but not every compiler ships it yet, so the value is spelled out.
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// ============================================================
+// Padded building blocks
+// ============================================================
+
+// Wraps any value so it owns a full cache line. An array of these puts every element
+// on its own line.
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) CacheLinePadded {
+    T value{};
+};
+
+// A thread safe counter that never shares its line with anything else
+class alignas(CACHE_LINE_SIZE) PaddedCounter {
+private:
+    std::atomic<uint64_t> count{0};
+public:
+    void add(uint64_t n = 1) { count.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t load() const { return count.load(std::memory_order_relaxed); }
+};
+
+/* A register that several threads may write (i6's "fakeRegister").
+    In i6 a single thread owns the register, so volatile was enough. Once several threads
+    set and clear bits, each read-modify-write must be atomic, otherwise one thread's
+    "set bit 0" can overwrite another thread's "set bit 1". std::atomic gives us that for a
+    simulated register in ordinary memory; real memory-mapped hardware would use volatile
+    accesses guarded by a lock or the chip's own set/clear registers.
+*/
+class alignas(CACHE_LINE_SIZE) PaddedRegister {
+private:
+    std::atomic<uint32_t> bits{0};
+public:
+    void setBits(uint32_t mask) { bits.fetch_or(mask, std::memory_order_relaxed); }
+    void clearBits(uint32_t mask) { bits.fetch_and(~mask, std::memory_order_relaxed); }
+    uint32_t read() const { return bits.load(std::memory_order_relaxed); }
+};
+
+/* Sharded Counter
+    Even a padded counter is one line that EVERY thread writes, so it still ping-pongs
+    (that is true sharing, not false sharing). A sharded counter gives every thread its own
+    padded slot. Writes never touch another thread's line, and a read adds all slots up
+    ("reduce on read"). Reads are slower, writes are as fast as a private variable.
+
+    Each thread picks its slot on its first add() (a thread_local index handed out by an
+    atomic counter), so callers never choose one. With more than MaxShards threads, slots
+    are shared again: still correct, but contended - size MaxShards to the thread count.
+*/
+template <size_t MaxShards>
+class ShardedCounter {
+private:
+    CacheLinePadded<std::atomic<uint64_t>> shards[MaxShards];
+
+    static size_t shardOfThisThread() {
+        static std::atomic<size_t> nextShard{0};
+        thread_local size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % MaxShards;
+        return shard;
+    }
+public:
+    void add(uint64_t n = 1) {
+        shards[shardOfThisThread()].value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t read() const {
+        uint64_t total = 0;
+        for (const auto& s : shards) total += s.value.load(std::memory_order_relaxed);
+        return total;
+    }
+};
+
+static_assert(sizeof(CacheLinePadded<uint64_t>) == CACHE_LINE_SIZE, "padded value must fill exactly one line");
+static_assert(sizeof(PaddedCounter) == CACHE_LINE_SIZE, "PaddedCounter must fill exactly one line");
+static_assert(alignof(PaddedRegister) == CACHE_LINE_SIZE, "PaddedRegister must start on a line boundary");
+
+// ============================================================
+// Layout audit
+// ============================================================
+
+// The hot structures we want to check. Each field is written by a different thread.
+struct PartyCoinsUnpadded {       // what a first attempt at threaded levelCoin looks like
+    std::atomic<uint64_t> warriorCoins{0};
+    std::atomic<uint64_t> mageCoins{0};
+    std::atomic<uint64_t> archerCoins{0};
+    std::atomic<uint64_t> healerCoins{0};
+};
+
+struct PartyCoinsPadded {         // same fields, one line each
+    PaddedCounter warriorCoins;
+    PaddedCounter mageCoins;
+    PaddedCounter archerCoins;
+    PaddedCounter healerCoins;
+};
+
+struct FieldInfo {
+    const char* name;
+    size_t offset;
+    size_t size;
+};
+
+#define FIELD(Type, member) FieldInfo{ #member, offsetof(Type, member), sizeof(Type::member) }
+
+// Prints which cache line every field lives on and flags lines shared by more than one field
+template <size_t N>
+void auditLayout(const char* typeName, size_t typeSize, const FieldInfo (&fields)[N]) {
+    std::cout << "[Audit] " << typeName << " (" << typeSize << " bytes)\n";
+    int shared = 0;
+    for (size_t i = 0; i < N; i++) {
+        size_t firstLine = fields[i].offset / CACHE_LINE_SIZE;
+        size_t lastLine = (fields[i].offset + fields[i].size - 1) / CACHE_LINE_SIZE;
+        std::cout << "    " << fields[i].name << "\t offset " << fields[i].offset << "\t line " << firstLine;
+        if (lastLine != firstLine) std::cout << "-" << lastLine << " (straddles a line boundary!)";
+        for (size_t j = 0; j < N; j++) {
+            if (j != i && fields[j].offset / CACHE_LINE_SIZE == firstLine) {
+                std::cout << "\t <- shares line with " << fields[j].name;
+                shared++;
+                break;
+            }
+        }
+        std::cout << "\n";
+    }
+    std::cout << (shared ? "    RESULT: false sharing possible between independently written fields\n"
+                         : "    RESULT: every field owns its cache line\n");
+}
+
+// ============================================================
+// False sharing benchmark
+// ============================================================
+using Clock = std::chrono::steady_clock;
+
+// Starts "threads" threads, thread t runs work(t), returns nanoseconds per increment
+template <typename Work>
+double timeThreads(unsigned threads, uint64_t increments, Work work) {
+    std::vector<std::thread> pool;
+    std::atomic<bool> go{false};
+    for (unsigned t = 0; t < threads; t++) {
+        pool.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire)) {} // start everyone at once
+            work(t);
+        });
+    }
+    Clock::time_point start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& th : pool) th.join();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return ns / (double)(increments * threads);
+}
+
+int main(int argc, char* argv[]) {
+    unsigned threads = (argc > 1) ? (unsigned)std::strtoul(argv[1], nullptr, 10) : 4;
+    uint64_t increments = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 5000000;
+    if (threads < 2 || threads > 4) { // one thread per party member below
+        std::cout << "[System] threads must be between 2 and 4 (got " << threads << ")\n";
+        return 1;
+    }
+
+    std::cout << "[System] Cache line size: " << CACHE_LINE_SIZE << " bytes, hardware threads: "
+              << std::thread::hardware_concurrency() << "\n\n";
+
+    // 1) Layout audit of the hot structures
+    const FieldInfo unpadded[] = {
+        FIELD(PartyCoinsUnpadded, warriorCoins), FIELD(PartyCoinsUnpadded, mageCoins),
+        FIELD(PartyCoinsUnpadded, archerCoins), FIELD(PartyCoinsUnpadded, healerCoins),
+    };
+    const FieldInfo padded[] = {
+        FIELD(PartyCoinsPadded, warriorCoins), FIELD(PartyCoinsPadded, mageCoins),
+        FIELD(PartyCoinsPadded, archerCoins), FIELD(PartyCoinsPadded, healerCoins),
+    };
+    auditLayout("PartyCoinsUnpadded", sizeof(PartyCoinsUnpadded), unpadded);
+    auditLayout("PartyCoinsPadded", sizeof(PartyCoinsPadded), padded);
+
+    // 2) Benchmark - every thread earns level coins for its own party member
+    std::cout << "\n[Bench] " << threads << " threads x " << increments << " increments\n";
+
+    PartyCoinsUnpadded coinsUnpadded;
+    std::atomic<uint64_t>* unpaddedSlots[] = {
+        &coinsUnpadded.warriorCoins, &coinsUnpadded.mageCoins, &coinsUnpadded.archerCoins, &coinsUnpadded.healerCoins
+    };
+    double nsUnpadded = timeThreads(threads, increments, [&](unsigned t) {
+        std::atomic<uint64_t>* mine = unpaddedSlots[t]; // pointer to this thread's own field
+        for (uint64_t i = 0; i < increments; i++) mine->fetch_add(1, std::memory_order_relaxed);
+    });
+
+    PartyCoinsPadded coinsPadded;
+    PaddedCounter* paddedSlots[] = {
+        &coinsPadded.warriorCoins, &coinsPadded.mageCoins, &coinsPadded.archerCoins, &coinsPadded.healerCoins
+    };
+    double nsPadded = timeThreads(threads, increments, [&](unsigned t) {
+        PaddedCounter* mine = paddedSlots[t];
+        for (uint64_t i = 0; i < increments; i++) mine->add();
+    });
+
+    std::atomic<uint64_t> sharedCoin{0}; // one counter for everyone (true sharing)
+    double nsShared = timeThreads(threads, increments, [&](unsigned) {
+        for (uint64_t i = 0; i < increments; i++) sharedCoin.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    ShardedCounter<4> shardedCoin;       // one counter, each thread gets its own padded slot
+    double nsSharded = timeThreads(threads, increments, [&](unsigned) {
+        for (uint64_t i = 0; i < increments; i++) shardedCoin.add();
+    });
+
+    PaddedRegister ledRegister;          // each thread flips its own bit of the register
+    double nsRegister = timeThreads(threads, increments, [&](unsigned t) {
+        uint32_t bit = 1u << t;
+        for (uint64_t i = 0; i < increments; i++) {
+            if (i & 1) ledRegister.clearBits(bit);
+            else ledRegister.setBits(bit);
+        }
+    });
+
+    std::cout << "    adjacent fields (false sharing)  " << nsUnpadded << " ns/op\t x" << nsUnpadded / nsPadded << "\n";
+    std::cout << "    padded fields                    " << nsPadded << " ns/op\t x1\n";
+    std::cout << "    single shared atomic             " << nsShared << " ns/op\t x" << nsShared / nsPadded << "\n";
+    std::cout << "    sharded counter                  " << nsSharded << " ns/op\t x" << nsSharded / nsPadded << "\n";
+    std::cout << "    shared register set/clear bits   " << nsRegister << " ns/op\t x" << nsRegister / nsPadded << "\n";
+
+    // Prove the counters are all correct - false sharing costs speed, never correctness
+    uint64_t expected = threads * increments;
+    uint32_t expectedBits = (increments & 1) ? (1u << threads) - 1 : 0; // an odd count ends on "set"
+    uint64_t unpaddedTotal = 0, paddedTotal = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        unpaddedTotal += unpaddedSlots[t]->load();
+        paddedTotal += paddedSlots[t]->load();
+    }
+    bool ok = unpaddedTotal == expected && paddedTotal == expected &&
+              sharedCoin.load() == expected && shardedCoin.read() == expected && ledRegister.read() == expectedBits;
+    std::cout << "\n[System] Totals " << (ok ? "match" : "DO NOT match") << " (" << expected << " coins each)\n";
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,233 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: i9_prefetch_traversal.cpp
+ * Description:
+ *   Strided, indexed-gather and linked traversal helpers that issue software
+ *   prefetches, with a benchmark against the plain pointer-increment loop.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    i4_array.cpp walks an array with "++ptr" and "*(numbers + i)". Because the array is
+    contiguous, the CPU notices the pattern and its HARDWARE PREFETCHER loads the next
+    cache lines before we ask for them, so the loop almost never waits on memory.
+
+    Real code does not always walk memory in order:
+        - Strided:  every N-th element (one field of a big record, a column of a matrix)
+        - Gather:   data[indices[i]]  (the indices jump all over the array)
+        - Linked:   node = node->next (the next address is unknown until this node loads)
+
+    The hardware can't guess gathers or linked lists, and large strides cross page boundaries
+    where most prefetchers stop. A SOFTWARE PREFETCH is a hint we give ourselves: "I will need
+    this address soon, start loading it now". It never faults, even on a bad address, and it
+    does not change the program's result - only how long it takes.
+
+    The trick is the DISTANCE: prefetch too close and the data is not there yet when we need it,
+    too far and it is evicted again before we get there (or we waste bandwidth). The benchmark
+    below sweeps distance and working set size so we can see where it helps.
+
+    Usage:
+        ./i9_prefetch_traversal [max working set in MB, default 64]
+*/
+
+#include <iostream>
+#include <iomanip>    // For std::setw
+#include <cstdint>    // For fixed-width integer types
+#include <cstdlib>    // For std::strtoul
+#include <vector>
+#include <random>     // For std::mt19937 and std::shuffle
+#include <algorithm>
+#include <chrono>     // For timing
+
+#if defined(_MSC_VER)
+    #include <xmmintrin.h>
+    #define PREFETCH(addr) _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#else
+    // read (0), keep in all cache levels (3)
+    #define PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#endif
+
+// Unoptimized builds don't inline the helpers' lambdas, so the sweep would measure call overhead
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && !defined(_DEBUG))
+    constexpr bool OPTIMIZED_BUILD = true;
+#else
+    constexpr bool OPTIMIZED_BUILD = false;
+#endif
+
+// ============================================================
+// Traversal helpers
+//   "distance" is how many elements ahead to prefetch, 0 turns prefetching off.
+//   "fn" is called with a reference to every visited element.
+// ============================================================
+
+// Visits base[0], base[stride], base[2 * stride], ... (count elements in total)
+template <typename T, typename Fn>
+void forEachStrided(const T* base, size_t count, size_t stride, size_t distance, Fn fn) {
+    for (size_t i = 0; i < count; i++) {
+        // Checked by index: even forming a pointer past the end of the array is UB (see part 3, i9)
+        if (distance && i + distance < count) PREFETCH(base + (i + distance) * stride);
+        fn(*(base + i * stride));
+    }
+}
+
+// Visits base[indices[0]], base[indices[1]], ...
+template <typename T, typename Fn>
+void forEachGather(const T* base, const uint32_t* indices, size_t count, size_t distance, Fn fn) {
+    for (size_t i = 0; i < count; i++) {
+        // The index array itself is read in order, so the hardware already prefetches it
+        if (distance && i + distance < count) PREFETCH(base + indices[i + distance]);
+        fn(*(base + indices[i]));
+    }
+}
+
+/* Linked nodes and jump pointers
+    To prefetch node N+8 we would have to follow 8 "next" pointers first, which means loading
+    those 8 nodes - the very thing we wanted to avoid. The classic fix is a JUMP POINTER: every
+    node also remembers the node "distance" steps ahead, set up once with buildJumpPointers().
+*/
+struct Node {
+    Node* next;
+    Node* jump;        // "distance" nodes ahead (or nullptr)
+    uint64_t value;
+    uint64_t pad[5];   // one node per 64 byte cache line, like a real record
+};
+
+void buildJumpPointers(Node* head, size_t distance) {
+    Node* ahead = head;
+    for (size_t i = 0; i < distance && ahead; i++) ahead = ahead->next;
+    for (Node* node = head; node; node = node->next) {
+        node->jump = distance ? ahead : nullptr;
+        if (ahead) ahead = ahead->next;
+    }
+}
+
+template <typename Fn>
+void forEachLinked(const Node* head, Fn fn) {
+    for (const Node* node = head; node; node = node->next) {
+        if (node->jump) PREFETCH(node->jump);
+        fn(*node);
+    }
+}
+
+// ============================================================
+// Benchmark
+// ============================================================
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t ACCESSES_PER_TEST = 1 << 21; // every measurement touches ~2M elements
+const size_t distances[] = { 0, 4, 8, 16, 32, 64 };
+constexpr size_t DISTANCE_COUNT = sizeof(distances) / sizeof(distances[0]);
+constexpr size_t STRIDE = 16; // uint64_t elements = 128 bytes, every access is a new cache line
+
+volatile uint64_t sink = 0;   // keeps the compiler from deleting the loops
+
+// Runs "pass" until about ACCESSES_PER_TEST elements were touched, returns ns per element
+template <typename Pass>
+double nsPerAccess(size_t accessesPerPass, Pass pass) {
+    size_t reps = std::max<size_t>(1, ACCESSES_PER_TEST / accessesPerPass);
+    pass(); // warm up (page faults, TLB)
+    Clock::time_point start = Clock::now();
+    for (size_t r = 0; r < reps; r++) pass();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return ns / (double)(reps * accessesPerPass);
+}
+
+void printRow(const char* pattern, size_t bytes, const double (&ns)[DISTANCE_COUNT], double plainNs) {
+    size_t best = 0;
+    for (size_t d = 1; d < DISTANCE_COUNT; d++) if (ns[d] < ns[best]) best = d;
+
+    std::cout << std::setw(8) << pattern << std::setw(9) << (bytes >> 10) << " KB";
+    for (double v : ns) std::cout << std::setw(8) << v;
+    std::cout << "   best d=" << std::setw(2) << distances[best]
+              << " (x" << std::setprecision(2) << ns[0] / ns[best] << " vs off, "
+              << ns[best] / plainNs << " x ++ptr)" << std::setprecision(3) << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxMB = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 64;
+    std::vector<size_t> workingSets = { 16u << 10, 256u << 10, 4u << 20, 64u << 20 };
+    workingSets.erase(std::remove_if(workingSets.begin(), workingSets.end(),
+                                     [&](size_t b) { return b > (maxMB << 20); }), workingSets.end());
+
+    std::mt19937 rng(42); // fixed seed so every run visits the same order
+    std::cout << std::fixed << std::setprecision(3);
+    if (!OPTIMIZED_BUILD) {
+        std::cout << "[Warning] Built without optimizations, these numbers do not reflect a real build. "
+                     "Use -O2 or CMAKE_BUILD_TYPE=Release.\n";
+    }
+    std::cout << "[Bench] ns per element, prefetch distance d (0 = off). Plain ++ptr = sequential loop from i4.\n";
+    std::cout << std::setw(8) << "pattern" << std::setw(12) << "set";
+    for (size_t d : distances) std::cout << std::setw(6) << "d=" << std::setw(2) << d;
+    std::cout << "\n";
+
+    for (size_t bytes : workingSets) {
+        size_t n = bytes / sizeof(uint64_t);
+        std::vector<uint64_t> data(n);
+        for (size_t i = 0; i < n; i++) data[i] = i;
+
+        // The i4 loop: contiguous "++ptr" traversal, what every other pattern is compared to
+        double plainNs = nsPerAccess(n, [&] {
+            uint64_t sum = 0;
+            for (const uint64_t* ptr = data.data(); ptr != data.data() + n; ++ptr) sum += *ptr;
+            sink = sink + sum;
+        });
+        std::cout << std::setw(8) << "++ptr" << std::setw(9) << (bytes >> 10) << " KB" << std::setw(8) << plainNs << "\n";
+
+        // Strided
+        double ns[DISTANCE_COUNT];
+        size_t stridedCount = n / STRIDE;
+        for (size_t d = 0; d < DISTANCE_COUNT; d++) {
+            ns[d] = nsPerAccess(stridedCount, [&] {
+                uint64_t sum = 0;
+                forEachStrided(data.data(), stridedCount, STRIDE, distances[d], [&](uint64_t v) { sum += v; });
+                sink = sink + sum;
+            });
+        }
+        printRow("strided", bytes, ns, plainNs);
+
+        // Gather (random indices, capped so huge sets still finish quickly)
+        size_t gatherCount = std::min(n, ACCESSES_PER_TEST);
+        std::vector<uint32_t> indices(gatherCount);
+        for (uint32_t& idx : indices) idx = (uint32_t)(rng() % n);
+        for (size_t d = 0; d < DISTANCE_COUNT; d++) {
+            ns[d] = nsPerAccess(gatherCount, [&] {
+                uint64_t sum = 0;
+                forEachGather(data.data(), indices.data(), gatherCount, distances[d], [&](uint64_t v) { sum += v; });
+                sink = sink + sum;
+            });
+        }
+        printRow("gather", bytes, ns, plainNs);
+
+        // Linked (nodes linked in a random order, so "next" jumps around memory)
+        size_t nodeCount = bytes / sizeof(Node);
+        std::vector<Node> nodes(nodeCount);
+        std::vector<uint32_t> order(nodeCount);
+        for (size_t i = 0; i < nodeCount; i++) order[i] = (uint32_t)i;
+        std::shuffle(order.begin(), order.end(), rng);
+        for (size_t i = 0; i < nodeCount; i++) {
+            nodes[order[i]].value = i;
+            nodes[order[i]].next = (i + 1 < nodeCount) ? &nodes[order[i + 1]] : nullptr;
+        }
+        Node* head = &nodes[order[0]];
+        for (size_t d = 0; d < DISTANCE_COUNT; d++) {
+            buildJumpPointers(head, distances[d]);
+            ns[d] = nsPerAccess(nodeCount, [&] {
+                uint64_t sum = 0;
+                forEachLinked(head, [&](const Node& node) { sum += node.value; });
+                sink = sink + sum;
+            });
+        }
+        printRow("linked", bytes, ns, plainNs);
+    }
+
+    return 0;
+}
@@ -79,7 +79,7 @@ exit /b
 :: ============================================================
 :build_gpp
 echo %CYAN%Compiling %filename% with g++...%RESET%
-g++ -std=c++17 -o test_program.exe src/%basename%.cpp
+g++ -std=c++17 -O2 -pthread -o test_program.exe src/%basename%.cpp
 
 if %errorlevel% neq 0 (
     echo %RED%Compilation failed.%RESET%
@@ -115,7 +115,7 @@ if %errorlevel% neq 0 (
     exit /b
 )
 
-cmake --build .
+cmake --build . --config Release
 
 if %errorlevel% neq 0 (
     echo %RED%Build failed.%RESET%
@@ -126,7 +126,7 @@ if %errorlevel% neq 0 (
 :: Run the program
 echo %GREEN%Running %basename%...%RESET%
 echo %CYAN%------------------------------------------------%RESET%
-call Debug\test_program.exe
+call Release\test_program.exe
 echo %CYAN%------------------------------------------------%RESET%
 
 pause
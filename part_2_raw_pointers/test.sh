@@ -70,7 +70,7 @@ fi
 # ============================================================
 if [[ "$build_method" -eq 1 ]]; then
     echo -e "${CYAN}Compiling $filename with g++...${RESET}"
-    g++ -std=c++17 -o "$basename" "src/$basename.cpp"
+    g++ -std=c++17 -O2 -pthread -o "$basename" "src/$basename.cpp"
 
     if [[ $? -ne 0 ]]; then
         echo -e "${RED}Compilation failed.${RESET}"
@@ -104,7 +104,7 @@ if [[ "$build_method" -eq 2 ]]; then
         exit 1
     fi
 
-    cmake --build .
+    cmake --build . --config Release
 
     if [[ $? -ne 0 ]]; then
         echo -e "${RED}Build failed.${RESET}"
@@ -114,7 +114,12 @@ if [[ "$build_method" -eq 2 ]]; then
     # Run the program
     echo -e "${GREEN}Running $basename...${RESET}"
     echo -e "${CYAN}------------------------------------------------${RESET}"
-    ./Debug/"$basename"
+    # Multi-config generators (Visual Studio, Xcode) put the program in Release/, Makefiles and Ninja do not
+    if [[ -x Release/test_program ]]; then
+        ./Release/test_program
+    else
+        ./test_program
+    fi
     echo -e "${CYAN}------------------------------------------------${RESET}"
 
     exit 0
@@ -0,0 +1,524 @@
+/******************************************************************************
+ * Project: Smart Pointers for Beginners
+ * File: alloc_profiler.cpp
+ * Description:
+ *   Allocation profiling mode. Linked into any example with -DALLOC_PROFILE=ON,
+ *   it reports heap vs stack usage for the whole program and per function.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-19-2026
+ * Last Modified: 10-19-2026
+ *****************************************************************************/
+
+/* Information..
+    Part 2 is all about WHERE memory lives. This file measures it while an example runs.
+
+    Heap:
+        Every "new" and "delete" in C++ goes through the global operator new / operator delete.
+        The standard lets a program replace them, so this file does. Each block gets a small
+        header in front of it (size, birth time, which function allocated it), then the real
+        memory comes from malloc. That gives us counts, bytes, size classes, the peak amount of
+        live heap and how long every block lived.
+
+    Stack:
+        Stack memory is never "allocated", the stack pointer just moves. To see it, the example
+        (NOT this file) is compiled with -finstrument-functions, which makes the compiler call
+        __cyg_profile_func_enter / __cyg_profile_func_exit around every function. We keep a
+        shadow call stack from those calls, which tells us:
+            - which function is running when "new" is called (per-function attribution)
+            - how far the stack has grown below main() (peak stack depth)
+
+    "Freed in same call" counts blocks that were deleted before the function that allocated
+    them returned, like myFunc() in i2_heap.cpp. Those are the first candidates to move onto
+    the stack or into an arena.
+
+    Build:
+        cmake .. -DSELECTED_FILE=i2_heap.cpp -DALLOC_PROFILE=ON
+        The report is written to alloc_profile_<example>.txt in the working directory.
+
+    NOTE: GCC/Clang only (needs -finstrument-functions and dladdr).
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstddef>   // For std::max_align_t
+#include <cstdint>   // For fixed-width integer types
+#include <cstring>
+#include <new>       // For std::align_val_t, std::nothrow_t, std::bad_alloc
+#include <atomic>
+#include <chrono>
+#include <dlfcn.h>   // For dladdr (function address -> name)
+#include <cxxabi.h>  // For abi::__cxa_demangle
+#include <pthread.h> // For the thread exit hook (pthread_key_create)
+#include <sched.h>   // For sched_yield
+
+#ifndef ALLOC_PROFILE_TARGET
+#define ALLOC_PROFILE_TARGET "example"
+#endif
+
+#define NO_INSTRUMENT __attribute__((no_instrument_function))
+
+namespace {
+
+// ============================================================
+// Bookkeeping (fixed size - the profiler must never call "new" itself)
+//   The hooks run on EVERY call of the example, so they take no lock: each thread counts
+//   into its own thread_local Counters, which are merged when the thread exits and when the
+//   report is written. Only the live heap totals (needed for the peak) are shared atomics.
+// ============================================================
+constexpr int SIZE_CLASSES = 16;   // <=16B, <=32B, ... <=256KB, bigger
+constexpr int LIFETIME_CLASSES = 8; // <1us, <10us, ... <1s, >=1s
+constexpr int MAX_FUNCTIONS = 512;
+constexpr int FUNCTION_SLOTS = 1024; // hash table size, power of two and at least 2 x MAX_FUNCTIONS
+constexpr int MAX_FRAMES = 1024;
+constexpr uint32_t HEADER_MAGIC = 0xA110C8ED;
+
+struct FunctionStats {
+    uint64_t calls;
+    uint64_t allocs;
+    uint64_t bytes;
+    uint64_t freedSameCall;
+    uint64_t freed;
+    uint64_t lifetimeNs;       // sum over freed blocks
+    int64_t liveBytes;         // may go negative per thread when another thread frees the block
+    uint64_t peakStackDepth;   // deepest entry into this function, bytes below the stack base
+};
+
+struct Counters {
+    uint64_t frees, bytes;
+    uint64_t freedSameCall;
+    uint64_t peakStackDepth;
+    uint64_t sizeClasses[SIZE_CLASSES];
+    uint64_t lifetimes[LIFETIME_CLASSES];
+    FunctionStats functions[MAX_FUNCTIONS]; // functions[0] is "outside instrumented code"
+};
+
+struct ThreadState {
+    Counters counters;
+    ThreadState* next;         // in the live thread list
+    uint64_t threadNumber;
+    uint64_t frameSerial;
+    bool registered;
+};
+
+// Shared, lock-free
+std::atomic<uint64_t> allocs{0};
+std::atomic<int64_t> liveBytes{0}, liveBlocks{0};
+std::atomic<int64_t> peakLiveBytes{0}, peakLiveBlocks{0};
+
+// Function address -> index, filled on the first call of each function (open addressing)
+struct FunctionSlot {
+    std::atomic<void*> fn;
+    std::atomic<int> index;    // index + 1, 0 while the inserting thread is still publishing it
+};
+FunctionSlot functionTable[FUNCTION_SLOTS];
+void* functionAddresses[MAX_FUNCTIONS];
+std::atomic<int> functionCount{1};  // slot 0 is reserved
+
+// Guarded by registryLock (thread start/exit and the report only)
+std::atomic_flag registryLock = ATOMIC_FLAG_INIT;
+ThreadState* liveThreads = nullptr;
+Counters retired = {};              // merged counters of threads that have exited
+Counters totals = {};               // scratch space for the report
+uint64_t threadsSeen = 0;
+pthread_key_t exitKey;
+bool exitKeyCreated = false;
+bool reportWritten = false;
+
+// Every block starts with this header, placed right before the pointer "new" returns
+struct AllocHeader {
+    size_t size;
+    size_t rawOffset;        // distance back to what malloc returned
+    uint64_t bornNs;
+    uint64_t birthFrame;     // serial of the call that allocated it
+    uint16_t function;       // index into the function table
+    uint32_t magic;
+};
+
+// One shadow stack per thread
+struct Frame {
+    void* fn;
+    uint64_t serial;
+    int function;
+};
+thread_local Frame frames[MAX_FRAMES];
+thread_local int frameDepth = 0;
+thread_local char* stackBase = nullptr;
+thread_local ThreadState threadState = {}; // trivial, so accessing it is just a TLS offset
+
+struct LockGuard {
+    NO_INSTRUMENT LockGuard() { while (registryLock.test_and_set(std::memory_order_acquire)) sched_yield(); }
+    NO_INSTRUMENT ~LockGuard() { registryLock.clear(std::memory_order_release); }
+};
+
+NO_INSTRUMENT void mergeInto(Counters& to, const Counters& from) {
+    to.frees += from.frees;
+    to.bytes += from.bytes;
+    to.freedSameCall += from.freedSameCall;
+    if (from.peakStackDepth > to.peakStackDepth) to.peakStackDepth = from.peakStackDepth;
+    for (int i = 0; i < SIZE_CLASSES; i++) to.sizeClasses[i] += from.sizeClasses[i];
+    for (int i = 0; i < LIFETIME_CLASSES; i++) to.lifetimes[i] += from.lifetimes[i];
+    for (int i = 0; i < MAX_FUNCTIONS; i++) {
+        FunctionStats& t = to.functions[i];
+        const FunctionStats& f = from.functions[i];
+        t.calls += f.calls;
+        t.allocs += f.allocs;
+        t.bytes += f.bytes;
+        t.freedSameCall += f.freedSameCall;
+        t.freed += f.freed;
+        t.lifetimeNs += f.lifetimeNs;
+        t.liveBytes += f.liveBytes;
+        if (f.peakStackDepth > t.peakStackDepth) t.peakStackDepth = f.peakStackDepth;
+    }
+}
+
+// pthread calls this when a registered thread exits (the main thread is merged by the report)
+NO_INSTRUMENT void retireThread(void* state) {
+    ThreadState* t = (ThreadState*)state;
+    LockGuard lock;
+    mergeInto(retired, t->counters);
+    for (ThreadState** link = &liveThreads; *link; link = &(*link)->next) {
+        if (*link == t) { *link = t->next; break; }
+    }
+    t->counters = Counters{};
+    t->registered = false; // a later allocation during thread exit registers it again
+}
+
+NO_INSTRUMENT ThreadState& currentThread() {
+    ThreadState& t = threadState;
+    if (!t.registered) {
+        LockGuard lock;
+        if (!exitKeyCreated) {
+            pthread_key_create(&exitKey, retireThread);
+            exitKeyCreated = true;
+        }
+        t.threadNumber = ++threadsSeen;
+        t.next = liveThreads;
+        liveThreads = &t;
+        t.registered = true;
+        pthread_setspecific(exitKey, &t);
+    }
+    return t;
+}
+
+NO_INSTRUMENT void updatePeak(std::atomic<int64_t>& peak, int64_t value) {
+    int64_t seen = peak.load(std::memory_order_relaxed);
+    while (value > seen && !peak.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+}
+
+NO_INSTRUMENT uint64_t nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+NO_INSTRUMENT int sizeClassOf(size_t size) {
+    int c = 0;
+    size_t limit = 16;
+    while (c < SIZE_CLASSES - 1 && size > limit) { limit <<= 1; c++; }
+    return c;
+}
+
+NO_INSTRUMENT int lifetimeClassOf(uint64_t ns) {
+    int c = 0;
+    uint64_t limit = 1000;
+    while (c < LIFETIME_CLASSES - 1 && ns >= limit) { limit *= 10; c++; }
+    return c;
+}
+
+// Finds (or adds) the stats slot for a function address. Usually one probe, no lock.
+NO_INSTRUMENT int functionIndex(void* fn) {
+    if (fn == nullptr) return 0;
+    size_t hash = (size_t)(((uintptr_t)fn >> 4) * 0x9E3779B97F4A7C15ull >> 32);
+    for (int probe = 0; probe < FUNCTION_SLOTS; probe++) {
+        FunctionSlot& slot = functionTable[(hash + probe) & (FUNCTION_SLOTS - 1)];
+        void* key = slot.fn.load(std::memory_order_acquire);
+        if (key == nullptr) {
+            if (slot.fn.compare_exchange_strong(key, fn, std::memory_order_acq_rel)) {
+                int index = functionCount.fetch_add(1, std::memory_order_relaxed);
+                if (index >= MAX_FUNCTIONS) {
+                    index = 0; // table full, counted as "outside"
+                } else {
+                    functionAddresses[index] = fn;
+                }
+                slot.index.store(index + 1, std::memory_order_release);
+                return index;
+            }
+            // Another thread took this slot first, "key" now holds its function
+        }
+        if (key == fn) {
+            int index;
+            while ((index = slot.index.load(std::memory_order_acquire)) == 0) {} // being published
+            return index - 1;
+        }
+    }
+    return 0;
+}
+
+NO_INSTRUMENT uint64_t currentStackDepth() {
+    char* here = (char*)__builtin_frame_address(0);
+    if (stackBase == nullptr || here > stackBase) return 0;
+    return (uint64_t)(stackBase - here);
+}
+
+// ============================================================
+// Heap tracking
+// ============================================================
+NO_INSTRUMENT void* trackedAlloc(size_t size, size_t align) {
+    if (align < alignof(std::max_align_t)) align = alignof(std::max_align_t);
+    size_t headerSpace = (sizeof(AllocHeader) + align - 1) / align * align;
+    size_t total = headerSpace + (size ? size : 1);
+
+    char* raw = (align > alignof(std::max_align_t))
+        ? (char*)std::aligned_alloc(align, (total + align - 1) / align * align)
+        : (char*)std::malloc(total);
+    if (raw == nullptr) return nullptr;
+
+    bool inFrame = frameDepth > 0 && frameDepth <= MAX_FRAMES;
+    int fn = inFrame ? frames[frameDepth - 1].function : 0;
+
+    char* user = raw + headerSpace;
+    AllocHeader* h = (AllocHeader*)user - 1;
+    h->size = size;
+    h->rawOffset = headerSpace;
+    h->bornNs = nowNs();
+    h->birthFrame = inFrame ? frames[frameDepth - 1].serial : 0;
+    h->function = (uint16_t)fn;
+    h->magic = HEADER_MAGIC;
+
+    allocs.fetch_add(1, std::memory_order_relaxed);
+    updatePeak(peakLiveBytes, liveBytes.fetch_add((int64_t)size, std::memory_order_relaxed) + (int64_t)size);
+    updatePeak(peakLiveBlocks, liveBlocks.fetch_add(1, std::memory_order_relaxed) + 1);
+
+    Counters& c = currentThread().counters;
+    uint64_t depth = currentStackDepth();
+    c.bytes += size;
+    if (depth > c.peakStackDepth) c.peakStackDepth = depth;
+    c.sizeClasses[sizeClassOf(size)]++;
+
+    FunctionStats& f = c.functions[fn];
+    f.allocs++;
+    f.bytes += size;
+    f.liveBytes += (int64_t)size;
+    return user;
+}
+
+NO_INSTRUMENT void trackedFree(void* ptr) {
+    if (ptr == nullptr) return;
+    AllocHeader* h = (AllocHeader*)ptr - 1;
+    if (h->magic != HEADER_MAGIC) { // not ours (or already freed) - let the pitfall happen as usual
+        std::free(ptr);
+        return;
+    }
+    h->magic = 0;
+    uint64_t lifetime = nowNs() - h->bornNs;
+    // Serials include the thread number, so a block freed by another thread never matches
+    bool sameCall = h->birthFrame != 0 && frameDepth > 0 && frameDepth <= MAX_FRAMES &&
+                    frames[frameDepth - 1].serial == h->birthFrame;
+
+    liveBytes.fetch_sub((int64_t)h->size, std::memory_order_relaxed);
+    liveBlocks.fetch_sub(1, std::memory_order_relaxed);
+
+    Counters& c = currentThread().counters;
+    c.frees++;
+    c.lifetimes[lifetimeClassOf(lifetime)]++;
+    if (sameCall) c.freedSameCall++;
+
+    FunctionStats& f = c.functions[h->function];
+    f.freed++;
+    f.lifetimeNs += lifetime;
+    f.liveBytes -= (int64_t)h->size;
+    if (sameCall) f.freedSameCall++;
+
+    std::free((char*)ptr - h->rawOffset);
+}
+
+NO_INSTRUMENT void* allocOrThrow(size_t size, size_t align) {
+    void* p = trackedAlloc(size, align);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+// ============================================================
+// Report
+// ============================================================
+NO_INSTRUMENT void functionName(void* fn, char* out, size_t outSize) {
+    if (fn == nullptr) {
+        std::snprintf(out, outSize, "<outside instrumented code>");
+        return;
+    }
+    Dl_info info;
+    if (dladdr(fn, &info) && info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status); // uses malloc
+        std::snprintf(out, outSize, "%s", status == 0 ? demangled : info.dli_sname);
+        std::free(demangled);
+    } else if (dladdr(fn, &info) && info.dli_fbase) {
+        // Lambdas and static functions are not exported - print the offset for "addr2line -f -C -e <exe>"
+        std::snprintf(out, outSize, "<local +0x%llx>", (unsigned long long)((char*)fn - (char*)info.dli_fbase));
+    } else {
+        std::snprintf(out, outSize, "<unknown %p>", fn);
+    }
+}
+
+NO_INSTRUMENT void printBar(FILE* out, uint64_t count, uint64_t max) {
+    int width = max ? (int)(count * 40 / max) : 0;
+    if (count && width == 0) width = 1;
+    for (int i = 0; i < width; i++) std::fputc('#', out);
+    std::fputc('\n', out);
+}
+
+NO_INSTRUMENT void writeReport(FILE* out) {
+    static const char* sizeLabels[SIZE_CLASSES] = {
+        "<= 16 B", "<= 32 B", "<= 64 B", "<= 128 B", "<= 256 B", "<= 512 B", "<= 1 KB", "<= 2 KB",
+        "<= 4 KB", "<= 8 KB", "<= 16 KB", "<= 32 KB", "<= 64 KB", "<= 128 KB", "<= 256 KB", "> 256 KB"
+    };
+    static const char* lifetimeLabels[LIFETIME_CLASSES] = {
+        "< 1 us", "< 10 us", "< 100 us", "< 1 ms", "< 10 ms", "< 100 ms", "< 1 s", ">= 1 s"
+    };
+
+    std::fprintf(out, "==============================================================\n");
+    std::fprintf(out, " Allocation profile: %s\n", ALLOC_PROFILE_TARGET);
+    std::fprintf(out, "==============================================================\n");
+    std::fprintf(out, " Heap (operator new / delete)\n");
+    std::fprintf(out, "   allocations         %llu\n", (unsigned long long)allocs.load());
+    std::fprintf(out, "   frees               %llu\n", (unsigned long long)totals.frees);
+    std::fprintf(out, "   bytes allocated     %llu\n", (unsigned long long)totals.bytes);
+    std::fprintf(out, "   peak live heap      %lld bytes in %lld blocks\n", (long long)peakLiveBytes.load(), (long long)peakLiveBlocks.load());
+    std::fprintf(out, "   live at exit        %lld bytes in %lld blocks%s\n", (long long)liveBytes.load(), (long long)liveBlocks.load(),
+                 liveBlocks.load() ? "  <- leaked (or freed by a static destructor)" : "");
+    std::fprintf(out, "   freed in same call  %llu of %llu  <- stack / arena candidates\n",
+                 (unsigned long long)totals.freedSameCall, (unsigned long long)allocs.load());
+    std::fprintf(out, " Stack\n");
+    std::fprintf(out, "   peak depth          %llu bytes below the first instrumented frame\n", (unsigned long long)totals.peakStackDepth);
+
+    uint64_t maxCount = 0;
+    for (uint64_t c : totals.sizeClasses) if (c > maxCount) maxCount = c;
+    std::fprintf(out, " Size classes\n");
+    for (int i = 0; i < SIZE_CLASSES; i++) {
+        if (totals.sizeClasses[i] == 0) continue;
+        std::fprintf(out, "   %-10s %8llu  ", sizeLabels[i], (unsigned long long)totals.sizeClasses[i]);
+        printBar(out, totals.sizeClasses[i], maxCount);
+    }
+
+    maxCount = 0;
+    for (uint64_t c : totals.lifetimes) if (c > maxCount) maxCount = c;
+    std::fprintf(out, " Lifetimes (freed blocks)\n");
+    for (int i = 0; i < LIFETIME_CLASSES; i++) {
+        if (totals.lifetimes[i] == 0) continue;
+        std::fprintf(out, "   %-10s %8llu  ", lifetimeLabels[i], (unsigned long long)totals.lifetimes[i]);
+        printBar(out, totals.lifetimes[i], maxCount);
+    }
+
+    // Sort function slots by bytes allocated (simple selection sort on indices, no "new")
+    int order[MAX_FUNCTIONS];
+    int count = functionCount.load() < MAX_FUNCTIONS ? functionCount.load() : MAX_FUNCTIONS;
+    for (int i = 0; i < count; i++) order[i] = i;
+    for (int i = 0; i < count; i++) {
+        int best = i;
+        for (int j = i + 1; j < count; j++) {
+            if (totals.functions[order[j]].bytes > totals.functions[order[best]].bytes) best = j;
+        }
+        int tmp = order[i]; order[i] = order[best]; order[best] = tmp;
+    }
+
+    std::fprintf(out, " Functions (sorted by bytes allocated)\n");
+    std::fprintf(out, "   %-40s %8s %8s %10s %10s %12s %12s %12s\n",
+                 "function", "calls", "allocs", "bytes", "same-call", "live@exit", "avg life ns", "peak stack");
+    char name[256];
+    for (int i = 0; i < count; i++) {
+        const FunctionStats& f = totals.functions[order[i]];
+        if (f.calls == 0 && f.allocs == 0) continue;
+        functionName(functionAddresses[order[i]], name, sizeof(name));
+        std::fprintf(out, "   %-40.40s %8llu %8llu %10llu %10llu %12lld %12llu %12llu\n", name,
+                     (unsigned long long)f.calls, (unsigned long long)f.allocs, (unsigned long long)f.bytes,
+                     (unsigned long long)f.freedSameCall, (long long)f.liveBytes,
+                     (unsigned long long)(f.freed ? f.lifetimeNs / f.freed : 0), (unsigned long long)f.peakStackDepth);
+    }
+}
+
+// Writes the report once the example has finished (after main returns)
+struct ReportAtExit {
+    NO_INSTRUMENT ~ReportAtExit() {
+        if (reportWritten) return;
+        reportWritten = true;
+        {
+            // Exited threads are already in "retired", add the ones still registered (main)
+            LockGuard lock;
+            totals = retired;
+            for (ThreadState* t = liveThreads; t; t = t->next) mergeInto(totals, t->counters);
+        }
+        char path[256];
+        std::snprintf(path, sizeof(path), "alloc_profile_%s.txt", ALLOC_PROFILE_TARGET);
+        FILE* file = std::fopen(path, "w");
+        if (file) {
+            writeReport(file);
+            std::fclose(file);
+            std::fprintf(stderr, "[AllocProfile] Report written to %s\n", path);
+        } else {
+            writeReport(stderr);
+        }
+    }
+} reportAtExit;
+
+} // namespace
+
+// ============================================================
+// -finstrument-functions hooks
+// ============================================================
+extern "C" NO_INSTRUMENT void __cyg_profile_func_enter(void* fn, void*) {
+    if (stackBase == nullptr) stackBase = (char*)__builtin_frame_address(0);
+    uint64_t depth = currentStackDepth();
+
+    ThreadState& t = currentThread();
+    int index = functionIndex(fn);
+    FunctionStats& f = t.counters.functions[index];
+    f.calls++;
+    if (depth > f.peakStackDepth) f.peakStackDepth = depth;
+    if (depth > t.counters.peakStackDepth) t.counters.peakStackDepth = depth;
+
+    if (frameDepth < MAX_FRAMES) {
+        // Thread number in the top bits keeps serials unique across threads without a shared counter
+        frames[frameDepth] = { fn, (t.threadNumber << 40) | ++t.frameSerial, index };
+    }
+    frameDepth++;
+}
+
+extern "C" NO_INSTRUMENT void __cyg_profile_func_exit(void*, void*) {
+    if (frameDepth > 0) frameDepth--;
+}
+
+// Total allocations so far, for examples that check their own allocation counts (i10)
+extern "C" NO_INSTRUMENT uint64_t alloc_profile_allocation_count() {
+    return allocs.load(std::memory_order_relaxed);
+}
+
+// ============================================================
+// Replacement global operator new / delete (every form the standard defines)
+// ============================================================
+void* operator new(size_t size) { return allocOrThrow(size, 0); }
+void* operator new[](size_t size) { return allocOrThrow(size, 0); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size, 0); }
+void* operator new(size_t size, std::align_val_t align) { return allocOrThrow(size, (size_t)align); }
+void* operator new[](size_t size, std::align_val_t align) { return allocOrThrow(size, (size_t)align); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return trackedAlloc(size, (size_t)align); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return trackedAlloc(size, (size_t)align); }
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedFree(ptr); }
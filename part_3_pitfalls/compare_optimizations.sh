@@ -0,0 +1,239 @@
+#!/bin/bash
+
+# ============================================================
+# Optimization-level comparison harness
+#   Builds every pitfall with each compiler at -O0/-O1/-O2/-O3/-Os (through
+#   run_all.sh, so the same CMake OPTIMIZATION_LEVEL knob is used), runs them,
+#   and compares program output, exit status and generated assembly size.
+#   The result is a matrix showing where the optimizer removed or changed the
+#   faulty accesses - bugs that only show up in optimized builds.
+#
+# Usage: ./compare_optimizations.sh [-c "g++ clang++"] [-l "-O0 -O1 -O2 -O3 -Os"] [-t timeout_seconds] [-b out_dir]
+#
+# Output: <out_dir>/opt_matrix.md (table + output variants) and <out_dir>/opt_matrix.csv
+# ============================================================
+
+# Define colors
+RED="\033[91m"
+GREEN="\033[92m"
+YELLOW="\033[93m"
+CYAN="\033[96m"
+RESET="\033[0m"
+
+script_dir=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+
+compilers="g++ clang++"
+levels="-O0 -O1 -O2 -O3 -Os"
+run_timeout=10
+out_dir="$script_dir/opt_matrix"
+
+while getopts "c:l:t:b:h" opt; do
+    case $opt in
+        c) compilers="$OPTARG" ;;
+        l) levels="$OPTARG" ;;
+        t) run_timeout="$OPTARG" ;;
+        b) out_dir="$OPTARG" ;;
+        *) sed -n '3,14p' "$0"; exit 1 ;;
+    esac
+done
+
+# Same timeout detection as run_all.sh (macOS has no "timeout", Homebrew's coreutils has "gtimeout")
+if command -v timeout >/dev/null; then
+    timeout_cmd=(timeout -k 2 "$run_timeout")
+elif command -v gtimeout >/dev/null; then
+    timeout_cmd=(gtimeout -k 2 "$run_timeout")
+else
+    echo -e "${YELLOW}'timeout' not found, reruns will run without a time limit.${RESET}"
+    timeout_cmd=()
+fi
+
+mkdir -p "$out_dir"
+out_dir=$(cd "$out_dir" && pwd)
+csv="$out_dir/opt_matrix.csv"
+md="$out_dir/opt_matrix.md"
+
+# Skip compilers that are not installed
+available=()
+for cxx in $compilers; do
+    if command -v "$cxx" >/dev/null; then
+        available+=("$cxx")
+    else
+        echo -e "${YELLOW}$cxx not found, skipping.${RESET}"
+    fi
+done
+if [[ ${#available[@]} -eq 0 ]]; then
+    echo -e "${RED}No compiler available.${RESET}"
+    exit 1
+fi
+
+pitfalls=()
+while IFS= read -r -d '' file; do
+    pitfalls+=("$(basename "$file" .cpp)")
+done < <(find "$script_dir/src" -maxdepth 1 -name "*.cpp" -print0 | sort -z)
+
+# Addresses change every run (ASLR), so they are masked before outputs are compared
+normalize() { sed -E 's/0x[0-9a-fA-F]+/0xADDR/g' "$1" 2>/dev/null; }
+
+# Counts instruction lines in the generated assembly (labels and .directives are skipped)
+asm_instructions() {
+    "$1" -std=c++17 "$2" -S -o - "$3" 2>/dev/null | grep -cE '^[[:space:]]+[a-z]'
+}
+
+# Pulls one field out of a run_all.sh summary entry (one entry per line)
+field() { sed -nE "s/.*\"$1\": \"?([^\",}]*)\"?.*/\1/p" <<< "$2"; }
+
+echo "pitfall,compiler,level,run,exit_code,signal,output_hash,asm_instructions,build_s,run_s,rerun_exit_code" > "$csv"
+
+# ============================================================
+# Build + run every (compiler, level) pair
+# ============================================================
+for cxx in "${available[@]}"; do
+    for level in $levels; do
+        build_dir="$out_dir/build_${cxx//[^a-zA-Z0-9]/_}${level}"
+        echo -e "${CYAN}Building and running with $cxx $level...${RESET}"
+        "$script_dir/run_all.sh" -O "$level" -t "$run_timeout" -b "$build_dir" -- "-DCMAKE_CXX_COMPILER=$cxx" > "$build_dir.log" 2>&1
+        # Non-zero = configure or build failed (crashing pitfalls don't fail run_all.sh in part 3)
+        if [[ $? -ne 0 || ! -f "$build_dir/run_summary.json" ]]; then
+            echo -e "${RED}run_all.sh failed for $cxx $level, see $build_dir.log${RESET}"
+            continue
+        fi
+
+        for name in "${pitfalls[@]}"; do
+            entry=$(grep "\"name\": \"$name\"" "$build_dir/run_summary.json")
+            run=$(field run "$entry")
+            exit_code=$(field exit_code "$entry")
+            signal=$(field signal "$entry")
+            hash=$(normalize "$build_dir/logs/$name.log" | cksum | cut -d ' ' -f 1)
+
+            # Run once more: output or exit status that changes between two runs of the SAME binary
+            # (heap garbage, stack leftovers, SIGABRT one run and SIGSEGV the next because of ASLR)
+            # is marked "?" so it is not mistaken for an optimizer difference
+            rerun_code=""
+            if [[ -x "$build_dir/$name" ]]; then
+                (cd "$build_dir" && "${timeout_cmd[@]}" "./$name" < /dev/null > "$build_dir/logs/$name.rerun.log" 2>&1) 2>/dev/null
+                rerun_code=$?
+                if [[ $rerun_code -eq 126 || $rerun_code -eq 127 ]]; then
+                    rerun_code="" # the rerun could not start, keep the first run's result and output
+                else
+                    rerun_hash=$(normalize "$build_dir/logs/$name.rerun.log" | cksum | cut -d ' ' -f 1)
+                    [[ "$rerun_hash" != "$hash" ]] && hash="?"
+                    [[ "$rerun_code" != "$exit_code" ]] && run="?"
+                fi
+            fi
+            asm=$(asm_instructions "$cxx" "$level" "$script_dir/src/$name.cpp")
+            echo "$name,$cxx,$level,$run,$exit_code,$signal,$hash,$asm,$(field build_s "$entry"),$(field run_s "$entry"),$rerun_code" >> "$csv"
+        done
+    done
+done
+
+# ============================================================
+# Matrix
+#   Each cell: <result> <output variant> <asm instructions>
+#   Output variants are lettered per pitfall (A = first seen). A "*" marks a cell whose
+#   result or output differs from the same compiler at the baseline level: -O0 when it is
+#   in the list, otherwise the first listed level.
+# ============================================================
+baseline_level=""
+for level in $levels; do
+    [[ -z "$baseline_level" || "$level" == "-O0" ]] && baseline_level="$level"
+done
+
+# What a cell shows as its result
+result_of() {
+    local run="$1" exit_code="$2" signal="$3"
+    case "$run" in
+        signal) echo "$signal" ;;
+        exit) echo "exit $exit_code" ;;
+        *) echo "$run" ;;  # "?" when the exit status changed between the two runs
+    esac
+}
+
+{
+    echo "# Pitfall behavior by compiler and optimization level"
+    echo
+    echo "Cell: \`result output-variant asm-instructions\`. \`?\` = result or output changes between two runs of the same binary. \`*\` = behaves differently than the same compiler at $baseline_level."
+    echo
+    header="| pitfall |"
+    divider="|---|"
+    for cxx in "${available[@]}"; do
+        for level in $levels; do
+            header+=" $cxx $level |"
+            divider+="---|"
+        done
+    done
+    echo "$header"
+    echo "$divider"
+
+    for name in "${pitfalls[@]}"; do
+        row="| $name |"
+        variants=()
+        for cxx in "${available[@]}"; do
+            # Baseline first, so the comparison does not depend on the order of -l
+            baseline_result=""
+            baseline_hash=""
+            line=$(grep "^$name,$cxx,$baseline_level," "$csv")
+            if [[ -n "$line" ]]; then
+                IFS=',' read -r _ _ _ run exit_code signal baseline_hash _ <<< "$line"
+                baseline_result=$(result_of "$run" "$exit_code" "$signal")
+            fi
+            for level in $levels; do
+                line=$(grep "^$name,$cxx,$level," "$csv")
+                if [[ -z "$line" ]]; then row+=" n/a |"; continue; fi
+                IFS=',' read -r _ _ _ run exit_code signal hash asm _ _ <<< "$line"
+
+                # Letter for this output ("?" = differs from run to run)
+                label=""
+                [[ "$hash" == "?" ]] && label="?"
+                for ((i = 0; i < ${#variants[@]}; i++)); do
+                    [[ "${variants[$i]}" == "$hash" ]] && label=$(printf "\\$(printf '%03o' $((65 + i)))")
+                done
+                if [[ -z "$label" ]]; then
+                    variants+=("$hash")
+                    label=$(printf "\\$(printf '%03o' $((64 + ${#variants[@]})))")
+                fi
+
+                result=$(result_of "$run" "$exit_code" "$signal")
+
+                # Compare with the baseline of the same compiler (a "?" result or output is never compared)
+                marker=""
+                if [[ "$level" == "$baseline_level" || -z "$baseline_result" ]]; then
+                    marker=""
+                elif [[ "$result" != "?" && "$baseline_result" != "?" && "$result" != "$baseline_result" ]]; then
+                    marker="*"
+                elif [[ "$hash" != "?" && "$baseline_hash" != "?" && "$hash" != "$baseline_hash" ]]; then
+                    marker="*"
+                fi
+                row+=" $result $label $asm$marker |"
+            done
+        done
+        echo "$row"
+    done
+
+    # Show what each lettered output actually printed (from the first build that produced it)
+    echo
+    echo "## Output variants"
+    for name in "${pitfalls[@]}"; do
+        echo
+        echo "### $name"
+        seen=()
+        for cxx in "${available[@]}"; do
+            for level in $levels; do
+                line=$(grep "^$name,$cxx,$level," "$csv")
+                [[ -z "$line" ]] && continue
+                hash=$(cut -d ',' -f 7 <<< "$line")
+                [[ "$hash" == "?" || " ${seen[*]} " == *" $hash "* ]] && continue
+                seen+=("$hash")
+                label=$(printf "\\$(printf '%03o' $((64 + ${#seen[@]})))")
+                echo
+                echo "**$label** (first seen: $cxx $level)"
+                echo '```'
+                normalize "$out_dir/build_${cxx//[^a-zA-Z0-9]/_}${level}/logs/$name.log" | head -n 8
+                echo '```'
+            done
+        done
+    done
+} > "$md"
+
+sed -n '/^| pitfall/,/^$/p' "$md"
+echo -e "${GREEN}Matrix written to $md and $csv${RESET}"
+exit 0
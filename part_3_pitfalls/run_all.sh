@@ -0,0 +1,202 @@
+#!/bin/bash
+
+# ============================================================
+# Non-interactive batch runner
+#   Configures once, builds every example in src/ in parallel, then runs each
+#   one with a timeout and writes a machine-readable summary (JSON).
+#
+# Usage: ./run_all.sh [-O level] [-j jobs] [-t timeout_seconds] [-b build_dir] [-o summary.json] [-- extra cmake args]
+#   e.g. ./run_all.sh -O -O2 -j 8
+#
+# Exit code: 0 when every example built, 1 otherwise. The pitfalls crash, leak
+# and misbehave BY DESIGN, so their exit codes and signals are only reported.
+# ============================================================
+
+# Compile timing hook - CMake calls this script as the compiler launcher (see below)
+if [[ "$1" == "--time-compile" ]]; then
+    timing_dir="$2"; shift 2
+    start=${EPOCHREALTIME:-$(date +%s)}
+    "$@"
+    status=$?
+    end=${EPOCHREALTIME:-$(date +%s)}
+
+    # Work out which example this object/executable belongs to from its "-o" argument
+    output=""
+    while [[ $# -gt 0 ]]; do
+        if [[ "$1" == "-o" ]]; then output="$2"; break; fi
+        shift
+    done
+    if [[ "$output" =~ CMakeFiles/([^/]+)\.dir/ ]]; then
+        target="${BASH_REMATCH[1]}"
+    else
+        target=$(basename "$output")
+    fi
+    [[ -n "$target" ]] && echo "$start $end" >> "$timing_dir/$target.time"
+    exit $status
+fi
+
+# Define colors
+RED="\033[91m"
+GREEN="\033[92m"
+YELLOW="\033[93m"
+CYAN="\033[96m"
+RESET="\033[0m"
+
+script_dir=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+script_path="$script_dir/$(basename "${BASH_SOURCE[0]}")"
+
+optimization_level="-O0"
+jobs=$(nproc 2>/dev/null || sysctl -n hw.ncpu 2>/dev/null || echo 2)
+run_timeout=10
+build_dir="$script_dir/build_all"
+summary=""
+
+while getopts "O:j:t:b:o:h" opt; do
+    case $opt in
+        O) optimization_level="$OPTARG" ;;
+        j) jobs="$OPTARG" ;;
+        t) run_timeout="$OPTARG" ;;
+        b) build_dir="$OPTARG" ;;
+        o) summary="$OPTARG" ;;
+        *) sed -n '3,12p' "$script_path"; exit 1 ;;
+    esac
+done
+shift $((OPTIND-1))
+[[ "$1" == "--" ]] && shift
+extra_cmake_args=("$@")
+
+mkdir -p "$build_dir"
+build_dir=$(cd "$build_dir" && pwd)
+summary="${summary:-$build_dir/run_summary.json}"
+timing_dir="$build_dir/timings"
+log_dir="$build_dir/logs"
+# A summary left from the last run must not survive a failed configure/build of this one
+rm -rf "$timing_dir" "$log_dir" "$summary"
+mkdir -p "$timing_dir" "$log_dir"
+
+now() { echo "${EPOCHREALTIME:-$(date +%s)}"; }
+elapsed() { awk -v s="$1" -v e="$2" 'BEGIN { printf "%.3f", e - s }'; }
+
+if command -v timeout >/dev/null; then
+    timeout_cmd=(timeout -k 2 "$run_timeout")
+elif command -v gtimeout >/dev/null; then
+    timeout_cmd=(gtimeout -k 2 "$run_timeout")
+else
+    echo -e "${YELLOW}'timeout' not found, examples will run without a time limit.${RESET}"
+    timeout_cmd=()
+fi
+
+# ============================================================
+# Configure once
+# ============================================================
+echo -e "${CYAN}Configuring all examples in $build_dir ($optimization_level)...${RESET}"
+t0=$(now)
+cmake -S "$script_dir" -B "$build_dir" -G "Unix Makefiles" -DBUILD_ALL_EXAMPLES=ON \
+    "-DOPTIMIZATION_LEVEL=$optimization_level" \
+    "-DCMAKE_CXX_COMPILER_LAUNCHER=$script_path;--time-compile;$timing_dir" \
+    "-DCMAKE_CXX_LINKER_LAUNCHER=$script_path;--time-compile;$timing_dir" \
+    "${extra_cmake_args[@]}" > "$log_dir/configure.log" 2>&1
+if [[ $? -ne 0 ]]; then
+    echo -e "${RED}CMake configuration failed, see $log_dir/configure.log${RESET}"
+    exit 1
+fi
+configure_s=$(elapsed "$t0" "$(now)")
+
+# ============================================================
+# Build everything in parallel from clean, so times compare across commits
+# (-k keeps going past a broken example)
+# ============================================================
+echo -e "${CYAN}Building with $jobs jobs...${RESET}"
+t0=$(now)
+cmake --build "$build_dir" --clean-first -- -j "$jobs" -k > "$log_dir/build.log" 2>&1
+build_s=$(elapsed "$t0" "$(now)")
+
+compiler=$(sed -n 's/^CMAKE_CXX_COMPILER:[A-Z]*=//p' "$build_dir/CMakeCache.txt")
+compiler_version=$("$compiler" --version 2>/dev/null | head -n 1)
+commit=$(git -C "$script_dir" rev-parse --short HEAD 2>/dev/null)
+
+# ============================================================
+# Run each example
+# ============================================================
+failures=0
+entries=()
+printf "${CYAN}%-32s %-8s %9s  %-16s %9s${RESET}\n" "example" "build" "build s" "result" "run s"
+
+while IFS= read -r -d '' file; do
+    name=$(basename "$file" .cpp)
+    binary="$build_dir/$name"
+    log="$log_dir/$name.log"
+
+    # Compile (and link) time = sum of every step the launcher timed for this target
+    compile_s=0
+    if [[ -f "$timing_dir/$name.time" ]]; then
+        compile_s=$(awk '{ sum += $2 - $1 } END { printf "%.3f", sum }' "$timing_dir/$name.time")
+    fi
+
+    build_status="ok"
+    run_status="not_run"
+    exit_code="null"
+    signal="null"
+    run_s=0
+
+    if [[ ! -x "$binary" ]]; then
+        build_status="failed"
+        failures=$((failures+1))
+    else
+        t0=$(now)
+        (cd "$build_dir" && "${timeout_cmd[@]}" "$binary" < /dev/null > "$log" 2>&1) 2>/dev/null  # no "Segmentation fault" noise
+        code=$?
+        run_s=$(elapsed "$t0" "$(now)")
+        exit_code=$code
+
+        if [[ ${#timeout_cmd[@]} -gt 0 && ( $code -eq 124 || $code -eq 137 ) ]]; then
+            run_status="timeout"
+        elif [[ $code -gt 128 ]]; then
+            run_status="signal"
+            signal="\"SIG$(kill -l $((code-128)) 2>/dev/null)\""
+        elif [[ $code -ne 0 ]]; then
+            run_status="exit"
+        else
+            run_status="ok"
+        fi
+    fi
+
+    color=$GREEN
+    [[ "$run_status" != "ok" ]] && color=$YELLOW  # expected for most pitfalls
+    [[ "$build_status" != "ok" ]] && color=$RED
+    result="$run_status"
+    [[ "$signal" != "null" ]] && result="${signal//\"/}"
+    [[ "$run_status" == "exit" ]] && result="exit $exit_code"
+    printf "${color}%-32s %-8s %9s  %-16s %9s${RESET}\n" "$name" "$build_status" "$compile_s" "$result" "$run_s"
+
+    entries+=("    {\"name\": \"$name\", \"build\": \"$build_status\", \"build_s\": $compile_s, \"run\": \"$run_status\", \"exit_code\": $exit_code, \"signal\": $signal, \"run_s\": $run_s, \"log\": \"$log\"}")
+done < <(find "$script_dir/src" -maxdepth 1 -name "*.cpp" -print0 | sort -z)
+
+# ============================================================
+# Machine-readable summary
+# ============================================================
+{
+    echo "{"
+    echo "  \"part\": \"$(basename "$script_dir")\","
+    echo "  \"commit\": \"$commit\","
+    echo "  \"optimization_level\": \"$optimization_level\","
+    echo "  \"compiler\": \"${compiler_version//\"/}\","
+    echo "  \"jobs\": $jobs,"
+    echo "  \"timeout_s\": $run_timeout,"
+    echo "  \"configure_s\": $configure_s,"
+    echo "  \"build_s\": $build_s,"
+    echo "  \"examples\": ["
+    for ((i = 0; i < ${#entries[@]}; i++)); do
+        if [[ $i -lt $((${#entries[@]}-1)) ]]; then echo "${entries[$i]},"; else echo "${entries[$i]}"; fi
+    done
+    echo "  ]"
+    echo "}"
+} > "$summary"
+
+echo -e "${CYAN}Configure ${configure_s}s, build ${build_s}s. Summary written to $summary${RESET}"
+
+if [[ $failures -ne 0 ]]; then
+    echo -e "${RED}$failures example(s) failed to build.${RESET}"
+    exit 1
+fi
+exit 0
@@ -107,7 +107,7 @@ if not exist build mkdir build
 cd build
 
 :: Run CMake with the selected file
-cmake .. -DSELECTED_FILE=%basename%.cpp
+cmake .. -DSELECTED_FILE=%basename%.cpp -DOPTIMIZATION_LEVEL=-O0
 
 if %errorlevel% neq 0 (
     echo %RED%CMake configuration failed.%RESET%
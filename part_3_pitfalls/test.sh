@@ -97,7 +97,7 @@ if [[ "$build_method" -eq 2 ]]; then
     cd build || exit 1
 
     # Run CMake with the selected file
-    cmake .. -DSELECTED_FILE="$basename.cpp"
+    cmake .. -DSELECTED_FILE="$basename.cpp" -DOPTIMIZATION_LEVEL=-O0
 
     if [[ $? -ne 0 ]]; then
         echo -e "${RED}CMake configuration failed.${RESET}"
@@ -114,7 +114,12 @@ if [[ "$build_method" -eq 2 ]]; then
     # Run the program
     echo -e "${GREEN}Running $basename...${RESET}"
     echo -e "${CYAN}------------------------------------------------${RESET}"
-    ./Debug/"$basename"
+    # Multi-config generators (Visual Studio, Xcode) put the program in Debug/, Makefiles and Ninja do not
+    if [[ -x Debug/test_program ]]; then
+        ./Debug/test_program
+    else
+        ./test_program
+    fi
     echo -e "${CYAN}------------------------------------------------${RESET}"
 
     exit 0